@@ -0,0 +1,40 @@
+#!/bin/bash
+if [ "$#" -lt 1 ]; then
+    echo "Usage: $0 <result.csv> [runs] [benchmark ...]"
+    echo "result.csv: the lsv_bench lines of all benchmarks and commands, overwritten"
+    echo "runs: the number of runs of each command, default 3"
+    echo "benchmark: the BLIF/AIGER files, default lsv/example, mytestdata and benchmarks"
+    exit 1
+fi
+
+result="$1"
+runs="${2:-3}"
+shift
+[ "$#" -gt 0 ] && shift
+bench_list=( "$@" )
+if [ "${#bench_list[@]}" -eq 0 ]; then
+    bench_list=( $(find -L lsv/example/ mytestdata/ benchmarks/ -type f \( -name '*.blif' -o -name '*.aig' \) 2>/dev/null) i10.aig )
+fi
+# lsv_print_sopunate needs an SOP network, the others take the strashed one
+cmd_list=( "sop|lsv_print_sopunate"
+           "strash|lsv_print_nodes"
+           "strash|lsv_print_pounate"
+           "strash|lsv_print_pounate -i"
+           "strash|lsv_print_pounate -p 4" )
+
+rm -f "${result}"
+for bench in "${bench_list[@]}"; do
+    echo "[INFO] Benchmarking ${bench} ..."
+    for entry in "${cmd_list[@]}"; do
+        prep="${entry%%|*}"
+        cmd="${entry#*|}"
+        if [ "${prep}" = "sop" ] && [ "${bench##*.}" = "aig" ]; then
+            prep="logic; sop"
+        fi
+        ./abc -c "read ${bench}; ${prep}; lsv_bench -N ${runs} -o ${result} ${cmd}" > /dev/null
+        if [ "$?" -ne 0 ]; then
+            echo "[ERROR] ${cmd} failed on ${bench}"
+        fi
+    done
+done
+echo "[INFO] Results are in ${result}"
@@ -133,6 +133,9 @@ struct Gia_Man_t_
     int            nFansAlloc;    // the size of fanout representation
     Vec_Int_t *    vFanoutNums;   // static fanout
     Vec_Int_t *    vFanout;       // static fanout
+    Vec_Int_t *    vFanoutCaps;   // dynamic fanout: the capacity of each fanout list
+    int            nFanoutFree;   // dynamic fanout: the number of abandoned entries
+    int            nFanoutMoves;  // dynamic fanout: the number of relocated lists
     Vec_Int_t *    vMapping;      // mapping for each node
     Vec_Wec_t *    vMapping2;     // mapping for each node
     Vec_Wec_t *    vFanouts2;     // mapping fanouts 
@@ -240,6 +243,20 @@ struct Gia_Man_t_
 };
 
 
+typedef struct Gia_Snap_t_ Gia_Snap_t;
+struct Gia_Snap_t_
+{
+    char *         pName;         // the AIG name
+    int            nPis;          // the number of PIs
+    int            nPos;          // the number of POs
+    int            nRegs;         // the number of flops
+    int            nAnds;         // the number of AND nodes
+    int            nLuts;         // the number of LUTs
+    Vec_Str_t *    vData;         // the compressed AIG
+    Gia_Man_t *    pGia;          // the uncompressed AIG (if it cannot be compressed)
+};
+
+
 typedef struct Gps_Par_t_ Gps_Par_t;
 struct Gps_Par_t_
 {
@@ -285,6 +302,8 @@ struct Gia_ParFra_t_
 
 
 // simulation parameters
+#define GIA_SIM_THR_MAX 64  // the largest number of simulation threads
+
 typedef struct Gia_ParSim_t_ Gia_ParSim_t;
 struct Gia_ParSim_t_
 {
@@ -296,6 +315,7 @@ struct Gia_ParSim_t_
     int            fCheckMiter;   // check if miter outputs are non-zero
     int            fVerbose;      // enables verbose output
     int            iOutFail;      // index of the failed output
+    int            nThreads;      // the number of simulation threads
 };
 
 typedef struct Gia_ManSim_t_ Gia_ManSim_t;
@@ -641,6 +661,7 @@ static inline word *       Gia_ObjSimObj( Gia_Man_t * p, Gia_Obj_t * pObj )    {
 
 // AIG construction
 extern void Gia_ObjAddFanout( Gia_Man_t * p, Gia_Obj_t * pObj, Gia_Obj_t * pFanout );
+extern void Gia_ManDynFanoutAddObj( Gia_Man_t * p, int iObj );
 static inline Gia_Obj_t * Gia_ManAppendObj( Gia_Man_t * p )  
 { 
     if ( p->nObjs == p->nObjsAlloc )
@@ -671,6 +692,8 @@ static inline int Gia_ManAppendCi( Gia_Man_t * p )
     pObj->iDiff0 = GIA_NONE;
     pObj->iDiff1 = Vec_IntSize( p->vCis );
     Vec_IntPush( p->vCis, Gia_ObjId(p, pObj) );
+    if ( p->vFanoutCaps )
+        Gia_ManDynFanoutAddObj( p, Gia_ObjId(p, pObj) );
     return Gia_ObjId( p, pObj ) << 1;
 }
 
@@ -702,6 +725,8 @@ static inline int Gia_ManAppendAnd( Gia_Man_t * p, int iLit0, int iLit1 )
         Gia_ObjAddFanout( p, Gia_ObjFanin0(pObj), pObj );
         Gia_ObjAddFanout( p, Gia_ObjFanin1(pObj), pObj );
     }
+    if ( p->vFanoutCaps )
+        Gia_ManDynFanoutAddObj( p, Gia_ObjId(p, pObj) );
     if ( p->fSweeper )
     {
         Gia_Obj_t * pFan0 = Gia_ObjFanin0(pObj);
@@ -744,6 +769,8 @@ static inline int Gia_ManAppendXorReal( Gia_Man_t * p, int iLit0, int iLit1 )
         pObj->fCompl0 = (unsigned)(Abc_LitIsCompl(iLit1));
     }
     p->nXors++;
+    if ( p->vFanoutCaps )
+        Gia_ManDynFanoutAddObj( p, Gia_ObjId(p, pObj) );
     return Gia_ObjId( p, pObj ) << 1;
 }
 static inline int Gia_ManAppendMuxReal( Gia_Man_t * p, int iLitC, int iLit1, int iLit0 )  
@@ -774,6 +801,8 @@ static inline int Gia_ManAppendMuxReal( Gia_Man_t * p, int iLitC, int iLit1, int
         p->pMuxes[Gia_ObjId(p, pObj)] = Abc_LitNot(iLitC);
     }
     p->nMuxes++;
+    if ( p->vFanoutCaps )
+        Gia_ManDynFanoutAddObj( p, Gia_ObjId(p, pObj) );
     return Gia_ObjId( p, pObj ) << 1;
 }
 static inline int Gia_ManAppendBuf( Gia_Man_t * p, int iLit )  
@@ -783,6 +812,8 @@ static inline int Gia_ManAppendBuf( Gia_Man_t * p, int iLit )
     pObj->iDiff0  = pObj->iDiff1  = Gia_ObjId(p, pObj) - Abc_Lit2Var(iLit);
     pObj->fCompl0 = pObj->fCompl1 = Abc_LitIsCompl(iLit);
     p->nBufs++;
+    if ( p->vFanoutCaps )
+        Gia_ManDynFanoutAddObj( p, Gia_ObjId(p, pObj) );
     return Gia_ObjId( p, pObj ) << 1;
 }
 static inline int Gia_ManAppendCo( Gia_Man_t * p, int iLit0 )  
@@ -798,6 +829,8 @@ static inline int Gia_ManAppendCo( Gia_Man_t * p, int iLit0 )
     Vec_IntPush( p->vCos, Gia_ObjId(p, pObj) );
     if ( p->pFanData )
         Gia_ObjAddFanout( p, Gia_ObjFanin0(pObj), pObj );
+    if ( p->vFanoutCaps )
+        Gia_ManDynFanoutAddObj( p, Gia_ObjId(p, pObj) );
     return Gia_ObjId( p, pObj ) << 1;
 }
 static inline int Gia_ManAppendOr( Gia_Man_t * p, int iLit0, int iLit1 )
@@ -1218,8 +1251,11 @@ static inline int         Gia_ObjCellId( Gia_Man_t * p, int iLit )          { re
 /*=== giaAiger.c ===========================================================*/
 extern int                 Gia_FileSize( char * pFileName );
 extern Gia_Man_t *         Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck );
+extern Gia_Man_t *         Gia_AigerReadFromMemoryPar( char * pContents, word nFileSize, int fGiaSimple, int fSkipStrash, int fCheck, int nThreads );
 extern Gia_Man_t *         Gia_AigerRead( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck );
+extern Gia_Man_t *         Gia_AigerReadPar( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck, int nThreads );
 extern void                Gia_AigerWrite( Gia_Man_t * p, char * pFileName, int fWriteSymbols, int fCompact, int fWriteNewLine );
+extern void                Gia_AigerWritePar( Gia_Man_t * p, char * pFileName, int fWriteSymbols, int fCompact, int fWriteNewLine, int nThreads );
 extern void                Gia_DumpAiger( Gia_Man_t * p, char * pFilePrefix, int iFileNum, int nFileNumDigits );
 extern Vec_Str_t *         Gia_AigerWriteIntoMemoryStr( Gia_Man_t * p );
 extern Vec_Str_t *         Gia_AigerWriteIntoMemoryStrPart( Gia_Man_t * p, Vec_Int_t * vCis, Vec_Int_t * vAnds, Vec_Int_t * vCos, int nRegs );
@@ -1403,6 +1439,13 @@ extern void                Gia_ManFanoutStart( Gia_Man_t * p );
 extern void                Gia_ManFanoutStop( Gia_Man_t * p );
 extern void                Gia_ManStaticFanoutStart( Gia_Man_t * p );
 extern void                Gia_ManStaticFanoutStop( Gia_Man_t * p );
+extern void                Gia_ManDynFanoutCompact( Gia_Man_t * p, int nRegion );
+extern void                Gia_ManDynFanoutStart( Gia_Man_t * p );
+extern void                Gia_ManDynFanoutAdd( Gia_Man_t * p, int iObj, int iFanout );
+extern int                 Gia_ManDynFanoutRemove( Gia_Man_t * p, int iObj, int iFanout );
+extern void                Gia_ManDynFanoutRemoveObj( Gia_Man_t * p, int iObj );
+extern int                 Gia_ManDynFanoutCheck( Gia_Man_t * p );
+extern void                Gia_ManDynFanoutTest( Gia_Man_t * p, int nEdits, int fVerbose );
 extern void                Gia_ManStaticMappingFanoutStart( Gia_Man_t * p );
 /*=== giaForce.c =========================================================*/
 extern void                For_ManExperiment( Gia_Man_t * pGia, int nIters, int fClustered, int fVerbose );
@@ -1522,6 +1565,13 @@ extern Gia_Man_t *         Gia_ManDupMuxes( Gia_Man_t * p, int Limit );
 extern Gia_Man_t *         Gia_ManDupNoMuxes( Gia_Man_t * p, int fSkipBufs );
 /*=== giaPat.c ===========================================================*/
 extern void                Gia_SatVerifyPattern( Gia_Man_t * p, Gia_Obj_t * pRoot, Vec_Int_t * vCex, Vec_Int_t * vVisit );
+/*=== giaReorder.c ===========================================================*/
+extern Vec_Int_t *         Gia_ManReorderDfs( Gia_Man_t * p, int fFrontier );
+extern Vec_Int_t *         Gia_ManReorderLevel( Gia_Man_t * p );
+extern Gia_Man_t *         Gia_ManReorderWithOrder( Gia_Man_t * p, Vec_Int_t * vOrder );
+extern void                Gia_ManReorderPrintLocality( Gia_Man_t * p );
+extern void                Gia_ManReorderBench( Gia_Man_t * p, int nWords );
+extern Gia_Man_t *         Gia_ManReorder( Gia_Man_t * p, int Type, int fVerbose );
 /*=== giaRetime.c ===========================================================*/
 extern Gia_Man_t *         Gia_ManRetimeForward( Gia_Man_t * p, int nMaxIters, int fVerbose );
 /*=== giaSat.c ============================================================*/
@@ -1553,6 +1603,9 @@ extern unsigned *          Gia_SimDataCoExt( Gia_ManSim_t * p, int i );
 extern void                Gia_ManSimInfoInit( Gia_ManSim_t * p );
 extern void                Gia_ManSimInfoTransfer( Gia_ManSim_t * p );
 extern void                Gia_ManSimulateRound( Gia_ManSim_t * p );
+extern int                 Gia_ManSimShardNum( int nWords, int nThreads, int nAlign );
+extern void                Gia_ManSimShardRange( int nWords, int nThreads, int nAlign, int iThread, int * pwStart, int * pwStop );
+extern void                Gia_ManSimRunThreads( void * (*pFunc)(void *), void * pThData, int nSize, int nThreads );
 extern void                Gia_ManBuiltInSimStart( Gia_Man_t * p, int nWords, int nObjs );
 extern void                Gia_ManBuiltInSimPerform( Gia_Man_t * p, int iObj );
 extern int                 Gia_ManBuiltInSimCheckOver( Gia_Man_t * p, int iLit0, int iLit1 );
@@ -1566,6 +1619,22 @@ extern int                 Gia_ManIncrSimCheckOver( Gia_Man_t * p, int iLit0, in
 extern int                 Gia_ManIncrSimCheckEqual( Gia_Man_t * p, int iLit0, int iLit1 );
 /*=== giaSimBase.c ============================================================*/
 extern Vec_Wrd_t *         Gia_ManSimPatSim( Gia_Man_t * p );
+extern Vec_Wrd_t *         Gia_ManSimPatSimOpt( Gia_Man_t * p, int fKernel, int nThreads );
+extern void                Gia_ManSimPatBench( Gia_Man_t * p, int nWords, int fKernel, int nThreads );
+extern Vec_Int_t *         Gia_ManSimPatOrder( Gia_Man_t * p );
+extern void                Gia_ManSimPatSimRange( Gia_Man_t * p, Vec_Int_t * vOrder, int nWords, Vec_Wrd_t * vSims, int wStart, int wStop );
+extern void                Gia_ManSimPatSimPar( Gia_Man_t * p, Vec_Int_t * vOrder, int nWords, Vec_Wrd_t * vSims, int nThreads );
+/*=== giaSnap.c ============================================================*/
+extern int                 Gia_SnapCanCompress( Gia_Man_t * p );
+extern Vec_Str_t *         Gia_SnapEncode( Gia_Man_t * p );
+extern Gia_Man_t *         Gia_SnapDecode( Vec_Str_t * vData );
+extern Gia_Snap_t *        Gia_SnapStart( Gia_Man_t * p );
+extern void                Gia_SnapStop( Gia_Snap_t * pSnap );
+extern void                Gia_SnapStopP( Gia_Snap_t ** ppSnap );
+extern void                Gia_SnapStopVec( Vec_Ptr_t ** pvSnaps );
+extern Gia_Man_t *         Gia_SnapRead( Gia_Snap_t * pSnap );
+extern double              Gia_SnapMemory( Gia_Snap_t * pSnap );
+extern void                Gia_SnapPrint( Gia_Snap_t * pSnap );
 /*=== giaSpeedup.c ============================================================*/
 extern float               Gia_ManDelayTraceLut( Gia_Man_t * p );
 extern float               Gia_ManDelayTraceLutPrint( Gia_Man_t * p, int fVerbose );
@@ -23,6 +23,24 @@
 #include "misc/tim/tim.h"
 #include "base/main/main.h"
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 #define XAIG_VERBOSE 0
@@ -31,6 +49,25 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+#define GIA_AIGER_PAR_MIN   (1 << 16)  // the smallest AND section processed in parallel
+#define GIA_AIGER_CHUNK     (1 << 20)  // the number of ANDs encoded by one thread at a time
+#define GIA_AIGER_THR_MAX   64         // the largest number of threads
+
+typedef struct Gia_AigerThData_t_ Gia_AigerThData_t;
+struct Gia_AigerThData_t_
+{
+    Gia_Man_t *     p;         // the AIG manager
+    unsigned char * pBuffer;   // the binary data of this chunk
+    unsigned char * pStop;     // the end of the binary data of this chunk
+    word            nVarints;  // the number of varints ending in the binary data of this chunk
+    int             nBytes;    // the number of bytes encoded into the buffer
+    int             iObj;      // the first AND object of this chunk
+    int             nAnds;     // the number of ANDs in this chunk
+    int *           pLits;     // the decoded fanin literals (two per AND) or NULL to decode into the objects
+    int             nBufs;     // the number of buffers decoded into the objects
+    int             fError;    // the chunk has a fanin literal that is out of range
+};
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -126,6 +163,17 @@ Vec_Int_t * Gia_AigerReadLiterals( unsigned char ** ppPos, int nEntries )
     }
     return vLits;
 }
+unsigned char * Gia_AigerSkipVarints( unsigned char * pCur, unsigned char * pEnd, word nVarints )
+{
+    for ( ; nVarints > 0; nVarints-- )
+    {
+        while ( pCur < pEnd && (*pCur & 0x80) )
+            pCur++;
+        if ( pCur++ == pEnd )
+            return NULL;
+    }
+    return pCur;
+}
 Vec_Str_t * Gia_AigerWriteLiterals( Vec_Int_t * vLits )
 {
     Vec_Str_t * vBinary;
@@ -162,6 +210,264 @@ Vec_Str_t * Gia_AigerWriteLiterals( Vec_Int_t * vLits )
     return vBinary;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Runs the worker function on each chunk.]
+
+  Description [Without pthreads, the chunks are processed one by one.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_AigerRunThreads( void * (*pFunc)(void *), Gia_AigerThData_t * pThData, int nThreads )
+{
+    int i;
+#ifdef ABC_USE_PTHREADS
+    pthread_t WorkerThread[GIA_AIGER_THR_MAX];
+    int status;
+    assert( nThreads <= GIA_AIGER_THR_MAX );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        status = pthread_create( WorkerThread + i, NULL, pFunc, (void *)(pThData + i) );  assert( status == 0 );
+    }
+    for ( i = 0; i < nThreads; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+    }
+#else
+    for ( i = 0; i < nThreads; i++ )
+        pFunc( (void *)(pThData + i) );
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Counts the varints ending in one chunk of the AND section.]
+
+  Description [The chunk starts at a varint boundary, so this is also
+  the number of varints starting in the chunk, except for the last one.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Gia_AigerCountThread( void * pArg )
+{
+    Gia_AigerThData_t * pThData = (Gia_AigerThData_t *)pArg;
+    unsigned char * pCur;
+    word nVarints = 0;
+    for ( pCur = pThData->pBuffer; pCur < pThData->pStop; pCur++ )
+        nVarints += (*pCur >> 7) ^ 1;
+    pThData->nVarints = nVarints;
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Decodes one chunk of the binary AND section.]
+
+  Description [The literals are either saved in the array (to be hashed
+  by the caller) or written directly into the objects of the manager.
+  Stops if a fanin literal is not below the literal of the AND.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Gia_AigerDecodeThread( void * pArg )
+{
+    Gia_AigerThData_t * pThData = (Gia_AigerThData_t *)pArg;
+    unsigned char * pCur = pThData->pBuffer;
+    unsigned uLit0, uLit1, uLit;
+    int i, iObj;
+    for ( i = 0; i < pThData->nAnds; i++ )
+    {
+        iObj  = pThData->iObj + i;
+        uLit  = Abc_Var2Lit( iObj, 0 );
+        uLit1 = uLit  - Gia_AigerReadUnsigned( &pCur );
+        uLit0 = uLit1 - Gia_AigerReadUnsigned( &pCur );
+        if ( uLit1 >= uLit || uLit0 > uLit1 )
+        {
+            pThData->fError = 1;
+            break;
+        }
+        if ( pThData->pLits )
+        {
+            pThData->pLits[2*i+0] = uLit0;
+            pThData->pLits[2*i+1] = uLit1;
+        }
+        else
+        {
+            Gia_Obj_t * pObj = Gia_ManObj( pThData->p, iObj );
+            pObj->iDiff0  = (unsigned)(iObj - Abc_Lit2Var(uLit0));
+            pObj->fCompl0 = Abc_LitIsCompl( uLit0 );
+            pObj->iDiff1  = (unsigned)(iObj - Abc_Lit2Var(uLit1));
+            pObj->fCompl1 = Abc_LitIsCompl( uLit1 );
+            pThData->nBufs += (uLit0 == uLit1);
+        }
+    }
+    pThData->pStop = pCur;
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Decodes the binary AND section using several threads.]
+
+  Description [The bytes that may belong to the section (at most 10 per
+  AND) are split into equal chunks, whose starts are moved forward to
+  the nearest varint boundary. The threads count the varints of their
+  chunks, which gives the first AND of each chunk, then they decode
+  their chunks concurrently. If vLits is NULL, the ANDs are written 
+  directly into the manager, which requires the literals of the CIs and 
+  ANDs to be the same as in the file. Otherwise, vLits is filled with 
+  two fanin literals per AND and hashing is left to the caller. Returns 
+  the first byte after the section, or NULL if the section is truncated
+  or has a fanin literal out of range.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+unsigned char * Gia_AigerDecodeAndsPar( Gia_Man_t * p, unsigned char * pCur, unsigned char * pEnd, int nAnds, int nCis, Vec_Int_t * vLits, int nThreads )
+{
+    Gia_AigerThData_t ThData[GIA_AIGER_THR_MAX];
+    word pFirst[GIA_AIGER_THR_MAX+1], nVarints = 2 * (word)nAnds;
+    word nBytes = Abc_MinWord( (word)(pEnd - pCur), 10 * (word)nAnds );
+    int i, k, kLast = -1;
+    assert( nThreads <= GIA_AIGER_THR_MAX );
+    memset( ThData, 0, sizeof(Gia_AigerThData_t) * nThreads );
+    if ( vLits )
+        Vec_IntFill( vLits, 2 * nAnds, 0 );
+    // split the bytes into chunks starting at varint boundaries
+    for ( k = 0; k < nThreads; k++ )
+    {
+        unsigned char * pStart = pCur + nBytes * k / nThreads;
+        if ( k > 0 && pStart < ThData[k-1].pBuffer )
+            pStart = ThData[k-1].pBuffer;
+        while ( k > 0 && pStart < pCur + nBytes && (pStart[-1] & 0x80) )
+            pStart++;
+        ThData[k].p       = p;
+        ThData[k].pBuffer = pStart;
+    }
+    for ( k = 0; k < nThreads; k++ )
+        ThData[k].pStop = k + 1 < nThreads ? ThData[k+1].pBuffer : pCur + nBytes;
+    Gia_AigerRunThreads( Gia_AigerCountThread, ThData, nThreads );
+    // find the varint that each chunk starts with
+    pFirst[0] = 0;
+    for ( k = 0; k < nThreads; k++ )
+        pFirst[k+1] = pFirst[k] + ThData[k].nVarints;
+    if ( pFirst[nThreads] < nVarints )
+        return NULL;
+    // each chunk decodes the ANDs starting in it
+    for ( k = 0; k < nThreads; k++ )
+    {
+        word iBeg = Abc_MinWord( (pFirst[k]   + 1) & ~(word)1, nVarints );
+        word iEnd = Abc_MinWord( (pFirst[k+1] + 1) & ~(word)1, nVarints );
+        ThData[k].nAnds = (int)((iEnd - iBeg) / 2);
+        if ( ThData[k].nAnds == 0 )
+            continue;
+        ThData[k].iObj  = 1 + nCis + (int)(iBeg / 2);
+        ThData[k].pLits = vLits ? Vec_IntEntryP( vLits, (int)iBeg ) : NULL;
+        // skip the second literal of the AND started in the previous chunk
+        if ( pFirst[k] & 1 )
+            while ( *ThData[k].pBuffer++ & 0x80 );
+        kLast = k;
+    }
+    assert( kLast >= 0 );
+    // reserve the objects to be filled in by the threads
+    if ( vLits == NULL )
+    {
+        assert( p->nObjs == 1 + nCis && p->nObjs + nAnds <= p->nObjsAlloc );
+        p->nObjs += nAnds;
+    }
+    Gia_AigerRunThreads( Gia_AigerDecodeThread, ThData, kLast + 1 );
+    for ( i = 0; i <= kLast; i++ )
+        if ( ThData[i].fError )
+            return NULL;
+    if ( vLits == NULL )
+        for ( i = 0; i <= kLast; i++ )
+            p->nBufs += ThData[i].nBufs;
+    return ThData[kLast].pStop;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Encodes one chunk of ANDs of the normalized AIG.]
+
+  Description []
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Gia_AigerEncodeThread( void * pArg )
+{
+    Gia_AigerThData_t * pThData = (Gia_AigerThData_t *)pArg;
+    Gia_Obj_t * pObj;
+    unsigned uLit0, uLit1, uLit;
+    int i, iObj, Pos = 0;
+    for ( i = 0; i < pThData->nAnds; i++ )
+    {
+        iObj  = pThData->iObj + i;
+        pObj  = Gia_ManObj( pThData->p, iObj );
+        uLit  = Abc_Var2Lit( iObj, 0 );
+        uLit0 = Gia_ObjFaninLit0( pObj, iObj );
+        uLit1 = Gia_ObjFaninLit1( pObj, iObj );
+        Pos = Gia_AigerWriteUnsignedBuffer( pThData->pBuffer, Pos, uLit  - uLit1 );
+        Pos = Gia_AigerWriteUnsignedBuffer( pThData->pBuffer, Pos, uLit1 - uLit0 );
+    }
+    pThData->nBytes = Pos;
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the binary AND section using several threads.]
+
+  Description [Each round, the threads encode consecutive chunks of ANDs
+  into their own buffers, which are then written in order.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_AigerEncodeAndsPar( Gia_Man_t * p, FILE * pFile, int nThreads )
+{
+    Gia_AigerThData_t ThData[GIA_AIGER_THR_MAX];
+    int i, k, nChunks, nAnds = Gia_ManAndNum(p), iObj = 1 + Gia_ManCiNum(p);
+    assert( Gia_ManIsNormalized(p) );
+    assert( nThreads <= GIA_AIGER_THR_MAX );
+    memset( ThData, 0, sizeof(Gia_AigerThData_t) * nThreads );
+    for ( k = 0; k < nThreads; k++ )
+    {
+        ThData[k].p       = p;
+        ThData[k].pBuffer = ABC_ALLOC( unsigned char, 10 * GIA_AIGER_CHUNK );
+    }
+    for ( i = 0; i < nAnds; )
+    {
+        for ( k = 0; k < nThreads && i < nAnds; k++ )
+        {
+            ThData[k].iObj  = iObj + i;
+            ThData[k].nAnds = Abc_MinInt( GIA_AIGER_CHUNK, nAnds - i );
+            i += ThData[k].nAnds;
+        }
+        nChunks = k;
+        Gia_AigerRunThreads( Gia_AigerEncodeThread, ThData, nChunks );
+        for ( k = 0; k < nChunks; k++ )
+            fwrite( ThData[k].pBuffer, 1, ThData[k].nBytes, pFile );
+    }
+    for ( k = 0; k < nThreads; k++ )
+        ABC_FREE( ThData[k].pBuffer );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Reads the AIG in the binary AIGER format.]
@@ -174,16 +480,35 @@ Vec_Str_t * Gia_AigerWriteLiterals( Vec_Int_t * vLits )
 
 ***********************************************************************/
 Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck )
+{
+    return Gia_AigerReadFromMemoryPar( pContents, (word)nFileSize, fGiaSimple, fSkipStrash, fCheck, 1 );
+}
+Gia_Man_t * Gia_AigerReadFromMemoryPar( char * pContents, word nFileSize, int fGiaSimple, int fSkipStrash, int fCheck, int nThreads )
 {
     Gia_Man_t * pNew, * pTemp;
-    Vec_Int_t * vLits = NULL, * vPoTypes = NULL;
+    Vec_Int_t * vLits = NULL, * vPoTypes = NULL, * vAndLits = NULL;
     Vec_Int_t * vNodes, * vDrivers, * vInits = NULL;
     int iObj, iNode0, iNode1, fHieOnly = 0;
     int nTotal, nInputs, nOutputs, nLatches, nAnds, i;
-    int nBad = 0, nConstr = 0, nJust = 0, nFair = 0;
-    unsigned char * pDrivers, * pSymbols, * pCur;
+    int nBad = 0, nConstr = 0, nJust = 0, nFair = 0, nSpaces = 0;
+    unsigned char * pDrivers, * pSymbols, * pSymEnd, * pCur;
+    unsigned char * pEnd = (unsigned char *)pContents + nFileSize;
     unsigned uLit0, uLit1, uLit;
 
+    if ( nThreads > GIA_AIGER_THR_MAX )
+    {
+        fprintf( stdout, "Warning: The number of threads is reduced to %d.\n", GIA_AIGER_THR_MAX );
+        nThreads = GIA_AIGER_THR_MAX;
+    }
+    // make sure the parameter line is complete before parsing it
+    for ( pCur = (unsigned char *)pContents; pCur < pEnd && *pCur != '\n'; pCur++ )
+        nSpaces += (*pCur == ' ');
+    if ( pCur == pEnd || nSpaces < 5 )
+    {
+        fprintf( stdout, "The parameter line is in a wrong format.\n" );
+        return NULL;
+    }
+
     // read the parameters (M I L O A + B C J F)
     pCur = (unsigned char *)pContents;         while ( *pCur != ' ' ) pCur++; pCur++;
     // read the number of objects
@@ -273,23 +598,70 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
     if ( pContents[3] == ' ' ) // standard AIGER
     {
         // scroll to the beginning of the binary data
-        for ( i = 0; i < nLatches + nOutputs; )
+        for ( i = 0; i < nLatches + nOutputs && pCur < pEnd; )
             if ( *pCur++ == '\n' )
                 i++;
+        if ( i < nLatches + nOutputs )
+            pCur = NULL;
     }
-    else // modified AIGER
+    else if ( Gia_AigerSkipVarints( pCur, pEnd, Abc_MaxInt(nLatches + nOutputs, 1) ) ) // modified AIGER
     {
         vLits = Gia_AigerReadLiterals( &pCur, nLatches + nOutputs );
     }
+    else
+        pCur = NULL;
+    if ( pCur == NULL )
+    {
+        fprintf( stdout, "The latch and output literals are truncated.\n" );
+        Vec_IntFree( vNodes );
+        Gia_ManStop( pNew );
+        return NULL;
+    }
+
+    // decode the AND gates in parallel
+    if ( nThreads > 1 && nAnds >= GIA_AIGER_PAR_MIN )
+    {
+        if ( !fGiaSimple && fSkipStrash ) // the objects are the same as in the file
+        {
+            pCur = Gia_AigerDecodeAndsPar( pNew, pCur, pEnd, nAnds, nInputs + nLatches, NULL, nThreads );
+            for ( i = 0; pCur && i < nAnds; i++ )
+                Vec_IntPush( vNodes, Abc_Var2Lit(i + 1 + nInputs + nLatches, 0) );
+        }
+        else // the literals are hashed below
+        {
+            vAndLits = Vec_IntAlloc( 0 );
+            pCur = Gia_AigerDecodeAndsPar( pNew, pCur, pEnd, nAnds, nInputs + nLatches, vAndLits, nThreads );
+        }
+        if ( pCur == NULL || vAndLits == NULL )
+            nAnds = 0;
+    }
 
     // create the AND gates
     if ( !fGiaSimple && !fSkipStrash )
         Gia_ManHashAlloc( pNew );
     for ( i = 0; i < nAnds; i++ )
     {
-        uLit = ((i + 1 + nInputs + nLatches) << 1);
-        uLit1 = uLit  - Gia_AigerReadUnsigned( &pCur );
-        uLit0 = uLit1 - Gia_AigerReadUnsigned( &pCur );
+        if ( vAndLits )
+        {
+            uLit0 = Vec_IntEntry( vAndLits, 2*i+0 );
+            uLit1 = Vec_IntEntry( vAndLits, 2*i+1 );
+        }
+        else
+        {
+            if ( pEnd - pCur < 10 && !Gia_AigerSkipVarints( pCur, pEnd, 2 ) )
+            {
+                pCur = NULL;
+                break;
+            }
+            uLit = ((i + 1 + nInputs + nLatches) << 1);
+            uLit1 = uLit  - Gia_AigerReadUnsigned( &pCur );
+            uLit0 = uLit1 - Gia_AigerReadUnsigned( &pCur );
+            if ( uLit1 >= uLit || uLit0 > uLit1 )
+            {
+                pCur = NULL;
+                break;
+            }
+        }
 //        assert( uLit1 > uLit0 );
         iNode0 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit0 >> 1), uLit0 & 1 );
         iNode1 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit1 >> 1), uLit1 & 1 );
@@ -306,9 +678,21 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
     }
     if ( !fGiaSimple && !fSkipStrash )
         Gia_ManHashStop( pNew );
+    Vec_IntFreeP( &vAndLits );
+    if ( pCur == NULL )
+    {
+        fprintf( stdout, "The AND section is truncated or has a fanin literal out of range.\n" );
+        if ( vLits )
+            Vec_IntFree( vLits );
+        Vec_IntFree( vNodes );
+        Gia_ManStop( pNew );
+        return NULL;
+    }
 
     // remember the place where symbols begin
     pSymbols = pCur;
+    // the symbol lines are parsed only up to the last new-line character
+    for ( pSymEnd = pEnd; pSymEnd > pSymbols && pSymEnd[-1] != '\n'; pSymEnd-- );
 
     // read the latch driver literals
     vDrivers = Vec_IntAlloc( nLatches + nOutputs );
@@ -375,14 +759,14 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
 
     // read signal names if they are of the special type
     pCur = pSymbols;
-    if ( pCur < (unsigned char *)pContents + nFileSize && *pCur != 'c' )
+    if ( pCur < pSymEnd && *pCur != 'c' )
     {
         int fBreakUsed = 0;
         unsigned char * pCurOld = pCur;
         pNew->vUserPiIds = Vec_IntStartFull( nInputs );
         pNew->vUserPoIds = Vec_IntStartFull( nOutputs );
         pNew->vUserFfIds = Vec_IntStartFull( nLatches );
-        while ( pCur < (unsigned char *)pContents + nFileSize && *pCur != 'c' )
+        while ( pCur < pSymEnd && *pCur != 'c' )
         {
             int iTerm;
             char * pType = (char *)pCur;
@@ -394,7 +778,12 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
                 break;
             }
             // get terminal number
-            iTerm = atoi( (char *)++pCur );  while ( *pCur++ != ' ' );
+            iTerm = atoi( (char *)++pCur );  while ( *pCur != ' ' && *pCur != '\n' ) pCur++;
+            if ( *pCur++ != ' ' )
+            {
+                fBreakUsed = 1;
+                break;
+            }
             // skip spaces
             while ( *pCur == ' ' )
                 pCur++;
@@ -437,7 +826,7 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
             // try to figure out signal names
             fBreakUsed = 0;
             pCur = (unsigned char *)pCurOld;
-            while ( pCur < (unsigned char *)pContents + nFileSize && *pCur != 'c' )
+            while ( pCur < pSymEnd && *pCur != 'c' )
             {
                 // get the terminal type
                 if ( *pCur == 'i' || *pCur == 'l' )
@@ -454,7 +843,12 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
                     break;
                 }
                 // get the terminal number
-                iTerm = atoi( (char *)++pCur );  while ( *pCur++ != ' ' );
+                iTerm = atoi( (char *)++pCur );  while ( *pCur != ' ' && *pCur != '\n' ) pCur++;
+                if ( *pCur++ != ' ' )
+                {
+                    fBreakUsed = 1;
+                    break;
+                }
                 // get the node
                 if ( iTerm < 0 || iTerm >= nOutputs )
                 {
@@ -882,22 +1276,55 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
 
 ***********************************************************************/
 Gia_Man_t * Gia_AigerRead( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck )
+{
+    return Gia_AigerReadPar( pFileName, fGiaSimple, fSkipStrash, fCheck, 1 );
+}
+Gia_Man_t * Gia_AigerReadPar( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck, int nThreads )
 {
     FILE * pFile;
     Gia_Man_t * pNew;
-    char * pName, * pContents;
-    int nFileSize;
-    int RetValue;
+    char * pName, * pContents = NULL;
+    word nFileSize = 0;
+    int RetValue, fMapped = 0;
 
-    // read the file into the buffer
     Gia_FileFixName( pFileName );
-    nFileSize = Gia_FileSize( pFileName );
-    pFile = fopen( pFileName, "rb" );
-    pContents = ABC_ALLOC( char, nFileSize );
-    RetValue = fread( pContents, nFileSize, 1, pFile );
-    fclose( pFile );
+#ifndef _WIN32
+    // map the file into memory (the parser writes into the contents, so the mapping is private)
+    {
+        struct stat Stat;
+        int fd = open( pFileName, O_RDONLY );
+        if ( fd != -1 && fstat( fd, &Stat ) == 0 && Stat.st_size > 0 )
+        {
+            pContents = (char *)mmap( NULL, (size_t)Stat.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0 );
+            if ( pContents == (char *)MAP_FAILED )
+                pContents = NULL;
+            else
+            {
+                nFileSize = (word)Stat.st_size;
+                madvise( pContents, (size_t)nFileSize, MADV_SEQUENTIAL );
+                fMapped = 1;
+            }
+        }
+        if ( fd != -1 )
+            close( fd );
+    }
+#endif
+    // otherwise, read the file into the buffer
+    if ( pContents == NULL )
+    {
+        nFileSize = Gia_FileSize( pFileName );
+        pFile = fopen( pFileName, "rb" );
+        pContents = ABC_ALLOC( char, nFileSize );
+        RetValue = fread( pContents, nFileSize, 1, pFile );
+        fclose( pFile );
+    }
 
-    pNew = Gia_AigerReadFromMemory( pContents, nFileSize, fGiaSimple, fSkipStrash, fCheck );
+    pNew = Gia_AigerReadFromMemoryPar( pContents, nFileSize, fGiaSimple, fSkipStrash, fCheck, nThreads );
+#ifndef _WIN32
+    if ( fMapped )
+        munmap( pContents, (size_t)nFileSize );
+    else
+#endif
     ABC_FREE( pContents );
     if ( pNew )
     {
@@ -1085,6 +1512,10 @@ Vec_Str_t * Gia_AigerWriteIntoMemoryStrPart( Gia_Man_t * p, Vec_Int_t * vCis, Ve
 
 ***********************************************************************/
 void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int fCompact, int fWriteNewLine )
+{
+    Gia_AigerWritePar( pInit, pFileName, fWriteSymbols, fCompact, fWriteNewLine, 1 );
+}
+void Gia_AigerWritePar( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int fCompact, int fWriteNewLine, int nThreads )
 {
     int fVerbose = XAIG_VERBOSE;
     FILE * pFile;
@@ -1095,6 +1526,11 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
     unsigned char * pBuffer;
     unsigned uLit0, uLit1, uLit;
     assert( pInit->nXors == 0 && pInit->nMuxes == 0 );
+    if ( nThreads > GIA_AIGER_THR_MAX )
+    {
+        fprintf( stdout, "Warning: The number of threads is reduced to %d.\n", GIA_AIGER_THR_MAX );
+        nThreads = GIA_AIGER_THR_MAX;
+    }
 
     if ( Gia_ManCoNum(pInit) == 0 )
     {
@@ -1157,31 +1593,36 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
     Gia_ManInvertConstraints( p );
 
     // write the nodes into the buffer
-    Pos = 0;
-    nBufferSize = 8 * Gia_ManAndNum(p) + 100; // skeptically assuming 3 chars per one AIG edge
-    pBuffer = ABC_ALLOC( unsigned char, nBufferSize );
-    Gia_ManForEachAnd( p, pObj, i )
+    if ( nThreads > 1 && Gia_ManAndNum(p) >= GIA_AIGER_PAR_MIN )
+        Gia_AigerEncodeAndsPar( p, pFile, nThreads );
+    else
     {
-        uLit  = Abc_Var2Lit( i, 0 );
-        uLit0 = Gia_ObjFaninLit0( pObj, i );
-        uLit1 = Gia_ObjFaninLit1( pObj, i );
-        assert( p->fGiaSimple || Gia_ManBufNum(p) || uLit0 < uLit1 );
-        Pos = Gia_AigerWriteUnsignedBuffer( pBuffer, Pos, uLit  - uLit1 );
-        Pos = Gia_AigerWriteUnsignedBuffer( pBuffer, Pos, uLit1 - uLit0 );
-        if ( Pos > nBufferSize - 10 )
+        Pos = 0;
+        nBufferSize = 8 * Gia_ManAndNum(p) + 100; // skeptically assuming 3 chars per one AIG edge
+        pBuffer = ABC_ALLOC( unsigned char, nBufferSize );
+        Gia_ManForEachAnd( p, pObj, i )
         {
-            printf( "Gia_AigerWrite(): AIGER generation has failed because the allocated buffer is too small.\n" );
-            fclose( pFile );
-            if ( p != pInit )
-                Gia_ManStop( p );
-            return;
+            uLit  = Abc_Var2Lit( i, 0 );
+            uLit0 = Gia_ObjFaninLit0( pObj, i );
+            uLit1 = Gia_ObjFaninLit1( pObj, i );
+            assert( p->fGiaSimple || Gia_ManBufNum(p) || uLit0 < uLit1 );
+            Pos = Gia_AigerWriteUnsignedBuffer( pBuffer, Pos, uLit  - uLit1 );
+            Pos = Gia_AigerWriteUnsignedBuffer( pBuffer, Pos, uLit1 - uLit0 );
+            if ( Pos > nBufferSize - 10 )
+            {
+                printf( "Gia_AigerWrite(): AIGER generation has failed because the allocated buffer is too small.\n" );
+                fclose( pFile );
+                if ( p != pInit )
+                    Gia_ManStop( p );
+                return;
+            }
         }
-    }
-    assert( Pos < nBufferSize );
+        assert( Pos < nBufferSize );
 
-    // write the buffer
-    fwrite( pBuffer, 1, Pos, pFile );
-    ABC_FREE( pBuffer );
+        // write the buffer
+        fwrite( pBuffer, 1, Pos, pFile );
+        ABC_FREE( pBuffer );
+    }
 
     // write the symbol table
     if ( p->vNamesIn && p->vNamesOut )
@@ -381,6 +381,276 @@ void Gia_ManStaticFanoutStop( Gia_Man_t * p )
 {
     Vec_IntFreeP( &p->vFanoutNums );
     Vec_IntFreeP( &p->vFanout );
+    Vec_IntFreeP( &p->vFanoutCaps );
+}
+
+
+/**Function*************************************************************
+
+  Synopsis    [Repacks dynamic fanout.]
+
+  Description [The dynamic fanout uses the layout of the static fanout,
+  so that the same iterators can be used, except that each fanout list
+  has some slack at the end and the offsets are kept for nRegion objects,
+  which may exceed the current number of objects.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Gia_ManDynFanoutSlack( int nFans ) { return nFans + (nFans >> 1) + 1; }
+
+void Gia_ManDynFanoutCompact( Gia_Man_t * p, int nRegion )
+{
+    Vec_Int_t * vFanout;
+    int i, k, nFans, nSize = nRegion, nRegionOld = Vec_IntSize(p->vFanoutCaps);
+    assert( nRegion >= nRegionOld );
+    Vec_IntFillExtra( p->vFanoutNums, nRegion, 0 );
+    Vec_IntFillExtra( p->vFanoutCaps, nRegion, 0 );
+    for ( i = 0; i < nRegion; i++ )
+        nSize += Gia_ManDynFanoutSlack( Vec_IntEntry(p->vFanoutNums, i) );
+    vFanout = Vec_IntAlloc( nSize );
+    Vec_IntFill( vFanout, nRegion, 0 );
+    for ( i = 0; i < nRegion; i++ )
+    {
+        nFans = Vec_IntEntry( p->vFanoutNums, i );
+        Vec_IntWriteEntry( vFanout, i, Vec_IntSize(vFanout) );
+        for ( k = 0; k < nFans; k++ )
+            Vec_IntPush( vFanout, Gia_ObjFanoutId(p, i, k) );
+        for ( ; k < Gia_ManDynFanoutSlack(nFans); k++ )
+            Vec_IntPush( vFanout, 0 );
+        Vec_IntWriteEntry( p->vFanoutCaps, i, Gia_ManDynFanoutSlack(nFans) );
+    }
+    assert( Vec_IntSize(vFanout) == nSize );
+    Vec_IntFree( p->vFanout );
+    p->vFanout = vFanout;
+    p->nFanoutFree = 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Allocates dynamic fanout.]
+
+  Description [After this, the fanouts of the new objects are added
+  automatically, while the changes to the fanins of the existing objects
+  should be recorded using Gia_ManDynFanoutAdd/Remove(). The fanouts are
+  accessed in the same way as the static fanout. The dynamic fanout is
+  deallocated by Gia_ManStaticFanoutStop().]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManDynFanoutStart( Gia_Man_t * p )
+{
+    assert( p->vFanoutCaps == NULL );
+    Gia_ManStaticFanoutStart( p );
+    p->vFanoutCaps  = Vec_IntDup( p->vFanoutNums );
+    p->nFanoutMoves = 0;
+    Gia_ManDynFanoutCompact( p, Gia_ManObjNum(p) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds or removes one fanout in amortized constant time.]
+
+  Description [When the list is full, it is moved to the end of the
+  array with twice the capacity. The array is repacked when the abandoned
+  entries take more than half of it, or when the object IDs exceed the
+  region of offsets, which is doubled.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManDynFanoutAdd( Gia_Man_t * p, int iObj, int iFanout )
+{
+    int k, nFans, nCap, iOff, iOffNew;
+    assert( p->vFanoutCaps != NULL );
+    if ( Abc_MaxInt(iObj, iFanout) >= Vec_IntSize(p->vFanoutCaps) )
+        Gia_ManDynFanoutCompact( p, 2 * (Abc_MaxInt(iObj, iFanout) + 1) );
+    nFans = Vec_IntEntry( p->vFanoutNums, iObj );
+    nCap  = Vec_IntEntry( p->vFanoutCaps, iObj );
+    if ( nFans == nCap )
+    {
+        iOff    = Gia_ObjFoffsetId( p, iObj );
+        iOffNew = Vec_IntSize( p->vFanout );
+        Vec_IntFillExtra( p->vFanout, iOffNew + 2 * nCap + 2, 0 );
+        for ( k = 0; k < nFans; k++ )
+            Vec_IntWriteEntry( p->vFanout, iOffNew + k, Vec_IntEntry(p->vFanout, iOff + k) );
+        Vec_IntWriteEntry( p->vFanout, iObj, iOffNew );
+        Vec_IntWriteEntry( p->vFanoutCaps, iObj, 2 * nCap + 2 );
+        p->nFanoutFree += nCap;
+        p->nFanoutMoves++;
+    }
+    Vec_IntWriteEntry( p->vFanout, Gia_ObjFoffsetId(p, iObj) + nFans, iFanout );
+    Vec_IntAddToEntry( p->vFanoutNums, iObj, 1 );
+    if ( 2 * p->nFanoutFree > Vec_IntSize(p->vFanout) )
+        Gia_ManDynFanoutCompact( p, Vec_IntSize(p->vFanoutCaps) );
+}
+int Gia_ManDynFanoutRemove( Gia_Man_t * p, int iObj, int iFanout )
+{
+    int k, nFans = Gia_ObjFanoutNumId( p, iObj );
+    int * pFans = Vec_IntEntryP( p->vFanout, Gia_ObjFoffsetId(p, iObj) );
+    assert( p->vFanoutCaps != NULL );
+    for ( k = 0; k < nFans; k++ )
+        if ( pFans[k] == iFanout )
+            break;
+    if ( k == nFans )
+        return 0;
+    pFans[k] = pFans[nFans-1];
+    Vec_IntAddToEntry( p->vFanoutNums, iObj, -1 );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds or removes the object as a fanout of its fanins.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManDynFanoutAddObj( Gia_Man_t * p, int iObj )
+{
+    Gia_Obj_t * pObj = Gia_ManObj( p, iObj );
+    if ( iObj >= Vec_IntSize(p->vFanoutCaps) )
+        Gia_ManDynFanoutCompact( p, 2 * (iObj + 1) );
+    if ( Gia_ObjIsAnd(pObj) || Gia_ObjIsCo(pObj) )
+        Gia_ManDynFanoutAdd( p, Gia_ObjFaninId0(pObj, iObj), iObj );
+    if ( Gia_ObjIsAnd(pObj) && !Gia_ObjIsBuf(pObj) )
+        Gia_ManDynFanoutAdd( p, Gia_ObjFaninId1(pObj, iObj), iObj );
+    if ( Gia_ObjIsMuxId(p, iObj) )
+        Gia_ManDynFanoutAdd( p, Gia_ObjFaninId2(p, iObj), iObj );
+}
+void Gia_ManDynFanoutRemoveObj( Gia_Man_t * p, int iObj )
+{
+    Gia_Obj_t * pObj = Gia_ManObj( p, iObj );
+    if ( Gia_ObjIsAnd(pObj) || Gia_ObjIsCo(pObj) )
+        Gia_ManDynFanoutRemove( p, Gia_ObjFaninId0(pObj, iObj), iObj );
+    if ( Gia_ObjIsAnd(pObj) && !Gia_ObjIsBuf(pObj) )
+        Gia_ManDynFanoutRemove( p, Gia_ObjFaninId1(pObj, iObj), iObj );
+    if ( Gia_ObjIsMuxId(p, iObj) )
+        Gia_ManDynFanoutRemove( p, Gia_ObjFaninId2(p, iObj), iObj );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Compares dynamic fanout with the static one.]
+
+  Description [Returns 1 if every object has the same fanouts in both,
+  up to the order.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManDynFanoutCheck( Gia_Man_t * p )
+{
+    Vec_Int_t * vFanoutNums = p->vFanoutNums;
+    Vec_Int_t * vFanout     = p->vFanout;
+    Vec_Int_t * vFanoutCaps = p->vFanoutCaps;
+    Vec_Int_t * vDyn = Vec_IntAlloc( 100 ), * vSta = Vec_IntAlloc( 100 );
+    int i, k, iFan, RetValue = 1;
+    p->vFanoutNums = p->vFanout = p->vFanoutCaps = NULL;
+    Gia_ManStaticFanoutStart( p );
+    for ( i = 0; i < Gia_ManObjNum(p) && RetValue; i++ )
+    {
+        Vec_IntClear( vSta );
+        Gia_ObjForEachFanoutStaticId( p, i, iFan, k )
+            Vec_IntPush( vSta, iFan );
+        Vec_IntClear( vDyn );
+        for ( k = 0; k < Vec_IntEntry(vFanoutNums, i); k++ )
+            Vec_IntPush( vDyn, Vec_IntEntry(vFanout, Vec_IntEntry(vFanout, i) + k) );
+        Vec_IntSort( vSta, 0 );
+        Vec_IntSort( vDyn, 0 );
+        RetValue = Vec_IntEqual( vSta, vDyn );
+    }
+    Gia_ManStaticFanoutStop( p );
+    p->vFanoutNums = vFanoutNums;
+    p->vFanout     = vFanout;
+    p->vFanoutCaps = vFanoutCaps;
+    Vec_IntFree( vDyn );
+    Vec_IntFree( vSta );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Compares incremental updates with rebuilding the fanout.]
+
+  Description [Performs nEdits small changes on a copy of the AIG: half
+  of them redirect the first fanin of a random node to a random earlier
+  node, and the other half add a new node. Reports the time taken by
+  the incremental updates and the time that rebuilding the static fanout
+  after every change would have taken.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManDynFanoutTest( Gia_Man_t * p, int nEdits, int fVerbose )
+{
+    Gia_Man_t * pNew = Gia_ManDup( p );
+    Gia_Obj_t * pObj;
+    int e, iObj, iFan, iFan1, nMoves, nDone = 0, RetValue;
+    abctime clkBuild, clkEdits, clk = Abc_Clock();
+    Gia_ManDynFanoutStart( pNew );
+    clkBuild = Abc_Clock() - clk;
+    Gia_ManRandom( 1 );
+    clk = Abc_Clock();
+    for ( e = 0; e < nEdits && Gia_ManAndNum(pNew) > 0; e++ )
+    {
+        iObj = 1 + Gia_ManRandom(0) % (Gia_ManObjNum(pNew) - 1);
+        pObj = Gia_ManObj( pNew, iObj );
+        if ( e & 1 )
+        {
+            // add a new node
+            iFan  = Gia_ManRandom(0) % Gia_ManObjNum(pNew);
+            iFan1 = Gia_ManRandom(0) % Gia_ManObjNum(pNew);
+            if ( iFan == iFan1 || Gia_ObjIsCo(Gia_ManObj(pNew, iFan)) || Gia_ObjIsCo(Gia_ManObj(pNew, iFan1)) )
+                continue;
+            Gia_ManAppendAnd( pNew, Abc_Var2Lit(iFan, 0), Abc_Var2Lit(iFan1, 1) );
+            nDone++;
+            continue;
+        }
+        // redirect the first fanin of an internal node
+        if ( !Gia_ObjIsAnd(pObj) || Gia_ObjIsXor(pObj) || Gia_ObjIsMux(pNew, pObj) || Gia_ObjIsBuf(pObj) )
+            continue;
+        iFan = Gia_ManRandom(0) % Gia_ObjFaninId1(pObj, iObj);
+        if ( Gia_ObjIsCo(Gia_ManObj(pNew, iFan)) )
+            continue;
+        RetValue = Gia_ManDynFanoutRemove( pNew, Gia_ObjFaninId0(pObj, iObj), iObj );
+        assert( RetValue );
+        pObj->iDiff0 = iObj - iFan;
+        Gia_ManDynFanoutAdd( pNew, iFan, iObj );
+        nDone++;
+    }
+    clkEdits = Abc_Clock() - clk;
+    nMoves = pNew->nFanoutMoves;
+    RetValue = Gia_ManDynFanoutCheck( pNew );
+    Gia_ManStaticFanoutStop( pNew );
+    // one full rebuild on the final AIG
+    clk = Abc_Clock();
+    Gia_ManStaticFanoutStart( pNew );
+    Gia_ManStaticFanoutStop( pNew );
+    clk = Abc_Clock() - clk;
+    printf( "Performed %d changes (%d lists moved). Fanout is %s.\n", nDone, nMoves, RetValue ? "correct" : "INCORRECT" );
+    ABC_PRT( "Starting dynamic fanout   ", clkBuild );
+    ABC_PRT( "Incremental updates       ", clkEdits );
+    ABC_PRT( "One static rebuild        ", clk );
+    ABC_PRT( "Rebuilds after each change", (abctime)nDone * clk );
+    if ( fVerbose )
+        Gia_ManPrintStats( pNew, NULL );
+    Gia_ManStop( pNew );
 }
 
 
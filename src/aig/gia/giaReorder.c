@@ -0,0 +1,375 @@
+/**CFile****************************************************************
+
+  FileName    [giaReorder.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Renumbering objects to improve memory locality.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: giaReorder.c,v 1.00 2026/10/17 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "gia.h"
+#include "misc/tim/tim.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+extern void Gia_StoComputeCuts( Gia_Man_t * pGia );
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Collects internal nodes in the DFS order.]
+
+  Description [The nodes are visited from the COs in their order, followed
+  by the dangling nodes. If fFrontier is 1, the fanin with the larger level
+  is visited first. This is the Sethi-Ullman order, which keeps the number
+  of values that are alive at the same time small, independently of the
+  cache size. The DFS uses an explicit stack to handle deep AIGs.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Gia_ManReorderPushFanins( Gia_Man_t * p, Vec_Int_t * vStack, int iObj, int fFrontier )
+{
+    Gia_Obj_t * pObj = Gia_ManObj( p, iObj );
+    int iFan0 = Gia_ObjFaninId0( pObj, iObj );
+    int iFan1 = Gia_ObjFaninId1( pObj, iObj );
+    // the fanin pushed last is visited first
+    if ( fFrontier && Gia_ObjLevelId(p, iFan1) > Gia_ObjLevelId(p, iFan0) )
+        ABC_SWAP( int, iFan0, iFan1 );
+    if ( Gia_ObjIsMuxId(p, iObj) )
+        Vec_IntPush( vStack, Abc_Var2Lit(Gia_ObjFaninId2(p, iObj), 0) );
+    Vec_IntPush( vStack, Abc_Var2Lit(iFan1, 0) );
+    Vec_IntPush( vStack, Abc_Var2Lit(iFan0, 0) );
+}
+Vec_Int_t * Gia_ManReorderDfs( Gia_Man_t * p, int fFrontier )
+{
+    Vec_Int_t * vOrder = Vec_IntAlloc( Gia_ManAndNum(p) );
+    Vec_Int_t * vStack = Vec_IntAlloc( 1000 );
+    Gia_Obj_t * pObj;
+    int i, iRoot, Entry;
+    if ( fFrontier )
+        Gia_ManLevelNum( p );
+    Gia_ManIncrementTravId( p );
+    Gia_ObjSetTravIdCurrentId( p, 0 );
+    Gia_ManForEachCi( p, pObj, i )
+        Gia_ObjSetTravIdCurrent( p, pObj );
+    for ( iRoot = 0; iRoot < Gia_ManCoNum(p) + Gia_ManObjNum(p); iRoot++ )
+    {
+        // roots are the CO drivers followed by all nodes, to include dangling ones
+        int iObj = iRoot < Gia_ManCoNum(p) ? Gia_ObjFaninId0p(p, Gia_ManCo(p, iRoot)) : iRoot - Gia_ManCoNum(p);
+        if ( !Gia_ObjIsAnd(Gia_ManObj(p, iObj)) || Gia_ObjIsTravIdCurrentId(p, iObj) )
+            continue;
+        Vec_IntPush( vStack, Abc_Var2Lit(iObj, 0) );
+        while ( Vec_IntSize(vStack) > 0 )
+        {
+            Entry = Vec_IntPop( vStack );
+            if ( Abc_LitIsCompl(Entry) )
+            {
+                Vec_IntPush( vOrder, Abc_Lit2Var(Entry) );
+                continue;
+            }
+            if ( Gia_ObjIsTravIdCurrentId(p, Abc_Lit2Var(Entry)) )
+                continue;
+            Gia_ObjSetTravIdCurrentId( p, Abc_Lit2Var(Entry) );
+            Vec_IntPush( vStack, Abc_LitNot(Entry) );
+            Gia_ManReorderPushFanins( p, vStack, Abc_Lit2Var(Entry), fFrontier );
+        }
+    }
+    Vec_IntFree( vStack );
+    assert( Vec_IntSize(vOrder) == Gia_ManAndNum(p) );
+    return vOrder;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Collects internal nodes in the order of their levels.]
+
+  Description [The nodes of the same level keep their relative order.
+  Buffers take the level of their fanin, so a buffer driven by a CI
+  or by the constant has level 0 and goes before the level-1 nodes.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Int_t * Gia_ManReorderLevel( Gia_Man_t * p )
+{
+    Vec_Int_t * vOrder;
+    Gia_Obj_t * pObj;
+    int i, nLevels = Gia_ManLevelNum( p );
+    int * pCounts = ABC_CALLOC( int, nLevels + 2 );
+    Gia_ManForEachAnd( p, pObj, i )
+        pCounts[Gia_ObjLevel(p, pObj)+1]++;
+    for ( i = 1; i <= nLevels + 1; i++ )
+        pCounts[i] += pCounts[i-1];
+    vOrder = Vec_IntStart( Gia_ManAndNum(p) );
+    Gia_ManForEachAnd( p, pObj, i )
+        Vec_IntWriteEntry( vOrder, pCounts[Gia_ObjLevel(p, pObj)]++, i );
+    ABC_FREE( pCounts );
+    return vOrder;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Remaps object-indexed arrays into the new numbering.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Vec_Int_t * Gia_ManReorderRemapVec( Gia_Man_t * pNew, Gia_Man_t * p, Vec_Int_t * vVec )
+{
+    Vec_Int_t * vRes;
+    Gia_Obj_t * pObj;
+    int i;
+    if ( vVec == NULL )
+        return NULL;
+    vRes = Vec_IntStart( Gia_ManObjNum(pNew) );
+    Gia_ManForEachObj( p, pObj, i )
+        if ( i < Vec_IntSize(vVec) && ~pObj->Value )
+            Vec_IntWriteEntry( vRes, Abc_Lit2Var(pObj->Value), Vec_IntEntry(vVec, i) );
+    return vRes;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Duplicates the AIG with the internal nodes in the given order.]
+
+  Description [The CIs and COs keep their order. The attached data indexed
+  by CIs, COs or flops is copied, while the equivalence classes, the LUT
+  mapping, the packing, the gate/object classes, the switching activity
+  and the original object IDs are renumbered. The AIGs with choices are
+  not supported.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Gia_ManReorderWithOrder( Gia_Man_t * p, Vec_Int_t * vOrder )
+{
+    Gia_Man_t * pNew;
+    Gia_Obj_t * pObj;
+    int i;
+    assert( !Gia_ManHasChoices(p) );
+    assert( Vec_IntSize(vOrder) == Gia_ManAndNum(p) );
+    Gia_ManFillValue( p );
+    pNew = Gia_ManStart( Gia_ManObjNum(p) );
+    pNew->pName = Abc_UtilStrsav( p->pName );
+    pNew->pSpec = Abc_UtilStrsav( p->pSpec );
+    if ( p->pMuxes )
+        pNew->pMuxes = ABC_CALLOC( unsigned, pNew->nObjsAlloc );
+    Gia_ManConst0(p)->Value = 0;
+    Gia_ManForEachCi( p, pObj, i )
+        pObj->Value = Gia_ManAppendCi( pNew );
+    Gia_ManForEachObjVec( vOrder, p, pObj, i )
+    {
+        if ( Gia_ObjIsBuf(pObj) )
+            pObj->Value = Gia_ManAppendBuf( pNew, Gia_ObjFanin0Copy(pObj) );
+        else if ( Gia_ObjIsXor(pObj) )
+            pObj->Value = Gia_ManAppendXorReal( pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+        else if ( Gia_ObjIsMux(p, pObj) )
+            pObj->Value = Gia_ManAppendMuxReal( pNew, Gia_ObjFanin2Copy(p, pObj), Gia_ObjFanin1Copy(pObj), Gia_ObjFanin0Copy(pObj) );
+        else
+            pObj->Value = Gia_ManAppendAnd( pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+    }
+    Gia_ManForEachCo( p, pObj, i )
+        pObj->Value = Gia_ManAppendCo( pNew, Gia_ObjFanin0Copy(pObj) );
+    Gia_ManSetRegNum( pNew, Gia_ManRegNum(p) );
+    assert( Gia_ManObjNum(pNew) == Gia_ManObjNum(p) );
+    pNew->nConstrs = p->nConstrs;
+    // data renumbered with the objects
+    Gia_ManDupRemapEquiv( pNew, p );
+    Gia_ManTransferMapping( pNew, p );
+    Gia_ManTransferPacking( pNew, p );
+    pNew->vGateClasses = Gia_ManReorderRemapVec( pNew, p, p->vGateClasses );
+    pNew->vObjClasses  = Gia_ManReorderRemapVec( pNew, p, p->vObjClasses );
+    pNew->vIdsOrig     = Gia_ManReorderRemapVec( pNew, p, p->vIdsOrig );
+    if ( p->pSwitching )
+    {
+        pNew->pSwitching = ABC_CALLOC( unsigned char, Gia_ManObjNum(pNew) );
+        Gia_ManForEachObj( p, pObj, i )
+            pNew->pSwitching[Abc_Lit2Var(pObj->Value)] = p->pSwitching[i];
+    }
+    // data indexed by CIs, COs and flops
+    if ( p->vNamesIn )     pNew->vNamesIn     = Vec_PtrDupStr( p->vNamesIn );
+    if ( p->vNamesOut )    pNew->vNamesOut    = Vec_PtrDupStr( p->vNamesOut );
+    if ( p->vFlopClasses ) pNew->vFlopClasses = Vec_IntDup( p->vFlopClasses );
+    if ( p->vRegClasses )  pNew->vRegClasses  = Vec_IntDup( p->vRegClasses );
+    if ( p->vRegInits )    pNew->vRegInits    = Vec_IntDup( p->vRegInits );
+    if ( p->vInArrs )      pNew->vInArrs      = Vec_FltDup( p->vInArrs );
+    if ( p->vOutReqs )     pNew->vOutReqs     = Vec_FltDup( p->vOutReqs );
+    if ( p->vCiArrs )      pNew->vCiArrs      = Vec_IntDup( p->vCiArrs );
+    if ( p->vCoReqs )      pNew->vCoReqs      = Vec_IntDup( p->vCoReqs );
+    if ( p->vCoArrs )      pNew->vCoArrs      = Vec_IntDup( p->vCoArrs );
+    if ( p->vCoAttrs )     pNew->vCoAttrs     = Vec_IntDup( p->vCoAttrs );
+    if ( p->vUserPiIds )   pNew->vUserPiIds   = Vec_IntDup( p->vUserPiIds );
+    if ( p->vUserPoIds )   pNew->vUserPoIds   = Vec_IntDup( p->vUserPoIds );
+    if ( p->vUserFfIds )   pNew->vUserFfIds   = Vec_IntDup( p->vUserFfIds );
+    if ( p->vCiNumsOrig )  pNew->vCiNumsOrig  = Vec_IntDup( p->vCiNumsOrig );
+    if ( p->vCoNumsOrig )  pNew->vCoNumsOrig  = Vec_IntDup( p->vCoNumsOrig );
+    if ( p->vConfigs )     pNew->vConfigs     = Vec_IntDup( p->vConfigs );
+    if ( p->pCellStr )     pNew->pCellStr     = Abc_UtilStrsav( p->pCellStr );
+    if ( p->pManTime )     pNew->pManTime     = Tim_ManDup( (Tim_Man_t *)p->pManTime, 0 );
+    if ( p->pAigExtra )    pNew->pAigExtra    = Gia_ManDup( p->pAigExtra );
+    if ( p->pCexSeq )      pNew->pCexSeq      = Abc_CexDup( p->pCexSeq, Gia_ManRegNum(p) );
+    if ( p->pCexComb )     pNew->pCexComb     = Abc_CexDup( p->pCexComb, -1 );
+    pNew->nAnd2Delay = p->nAnd2Delay;
+    pNew->And2Delay  = p->And2Delay;
+    pNew->DefInArrs  = p->DefInArrs;
+    pNew->DefOutReqs = p->DefOutReqs;
+    return pNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reports the locality of the current object order.]
+
+  Description [Prints the average distance between a node and its fanins
+  and the largest number of values alive when the objects are visited in
+  the order of their IDs.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManReorderPrintLocality( Gia_Man_t * p )
+{
+    Gia_Obj_t * pObj;
+    int * pRefs = ABC_CALLOC( int, Gia_ManObjNum(p) );
+    int i, nLive = 0, nLiveMax = 0;
+    double Dist = 0;
+    Gia_ManForEachAnd( p, pObj, i )
+    {
+        pRefs[Gia_ObjFaninId0(pObj, i)]++;
+        pRefs[Gia_ObjFaninId1(pObj, i)]++;
+        Dist += (i - Gia_ObjFaninId0(pObj, i)) + (i - Gia_ObjFaninId1(pObj, i));
+    }
+    Gia_ManForEachCo( p, pObj, i )
+        pRefs[Gia_ObjFaninId0p(p, pObj)]++;
+    Gia_ManForEachObj1( p, pObj, i )
+    {
+        if ( Gia_ObjIsAnd(pObj) )
+        {
+            if ( --pRefs[Gia_ObjFaninId0(pObj, i)] == 0 )
+                nLive--;
+            if ( Gia_ObjFaninId1(pObj, i) != Gia_ObjFaninId0(pObj, i) && --pRefs[Gia_ObjFaninId1(pObj, i)] == 0 )
+                nLive--;
+        }
+        else if ( Gia_ObjIsCo(pObj) && --pRefs[Gia_ObjFaninId0p(p, pObj)] == 0 )
+            nLive--;
+        if ( !Gia_ObjIsCo(pObj) && pRefs[i] > 0 )
+            nLive++;
+        nLiveMax = Abc_MaxInt( nLiveMax, nLive );
+    }
+    ABC_FREE( pRefs );
+    printf( "Fanin distance = %9.1f.  Max live values = %9d.  ", Gia_ManAndNum(p) ? Dist / (2 * Gia_ManAndNum(p)) : 0.0, nLiveMax );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs the simulation and cut enumeration benchmark.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManReorderBench( Gia_Man_t * p, int nWords )
+{
+    Vec_Wrd_t * vSimsPi = p->vSimsPi, * vSims;
+    abctime clk;
+    Gia_ManReorderPrintLocality( p );
+    printf( "\n" );
+    p->vSimsPi = Vec_WrdStartRandom( Gia_ManCiNum(p) * nWords );
+    clk = Abc_ClockWall();
+    vSims = Gia_ManSimPatSim( p );
+    Abc_PrintTime( 1, "Simulation of 64*W patterns", Abc_ClockWall() - clk );
+    Vec_WrdFree( vSims );
+    Vec_WrdFree( p->vSimsPi );
+    p->vSimsPi = vSimsPi;
+    clk = Abc_ClockWall();
+    Gia_StoComputeCuts( p );
+    Abc_PrintTime( 1, "Enumeration of 6-input cuts ", Abc_ClockWall() - clk );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Renumbers the objects to improve memory locality.]
+
+  Description [Type 0 is the DFS order from the COs, Type 1 is the order
+  of levels, and Type 2 is the DFS order visiting the fanin with the larger
+  level first, which keeps the working set of the passes small for any
+  cache size. Equivalence classes are kept only by the DFS orders.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Gia_ManReorder( Gia_Man_t * p, int Type, int fVerbose )
+{
+    Gia_Man_t * pNew;
+    Vec_Int_t * vOrder;
+    abctime clk = Abc_Clock();
+    if ( Type == 1 && p->pReprs )
+    {
+        printf( "The order of levels is not a DFS order, which is expected by the users of equivalence classes.\n" );
+        return NULL;
+    }
+    if ( Type == 0 )
+        vOrder = Gia_ManReorderDfs( p, 0 );
+    else if ( Type == 1 )
+        vOrder = Gia_ManReorderLevel( p );
+    else if ( Type == 2 )
+        vOrder = Gia_ManReorderDfs( p, 1 );
+    else
+    {
+        printf( "Unknown reordering type %d.\n", Type );
+        return NULL;
+    }
+    pNew = Gia_ManReorderWithOrder( p, vOrder );
+    Vec_IntFree( vOrder );
+    if ( fVerbose )
+    {
+        printf( "Before: " );  Gia_ManReorderPrintLocality( p );     printf( "\n" );
+        printf( "After:  " );  Gia_ManReorderPrintLocality( pNew );  Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    return pNew;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
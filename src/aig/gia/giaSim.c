@@ -21,6 +21,17 @@
 #include "gia.h"
 #include "misc/util/utilTruth.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -28,6 +39,14 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+typedef struct Gia_ManSimThData_t_ Gia_ManSimThData_t;
+struct Gia_ManSimThData_t_
+{
+    Gia_ManSim_t * p;
+    int            wStart;
+    int            wStop;
+};
+
 static inline unsigned * Gia_SimData( Gia_ManSim_t * p, int i )    { return p->pDataSim + i * p->nWords;    }
 static inline unsigned * Gia_SimDataCi( Gia_ManSim_t * p, int i )  { return p->pDataSimCis + i * p->nWords; }
 static inline unsigned * Gia_SimDataCo( Gia_ManSim_t * p, int i )  { return p->pDataSimCos + i * p->nWords; }
@@ -151,6 +170,52 @@ Vec_Int_t * Gia_ManSimDeriveResets( Gia_Man_t * pGia )
 }
 
 
+/**Function*************************************************************
+
+  Synopsis    [Splits the simulation words among the threads.]
+
+  Description [Each thread simulates the whole AIG on its own range of 
+  words, so the threads do not share any simulation data. The ranges are 
+  multiples of nAlign words, except the last one, so that the threads do 
+  not write into the same cache lines and each has enough work.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManSimShardNum( int nWords, int nThreads, int nAlign )
+{
+    int nBlocks = (nWords + nAlign - 1) / nAlign;
+    return Abc_MaxInt( 1, Abc_MinInt(Abc_MinInt(nThreads, GIA_SIM_THR_MAX), nBlocks) );
+}
+void Gia_ManSimShardRange( int nWords, int nThreads, int nAlign, int iThread, int * pwStart, int * pwStop )
+{
+    int nBlocks = (nWords + nAlign - 1) / nAlign;
+    *pwStart = Abc_MinInt( nWords, nAlign * (int)((word)nBlocks * iThread / nThreads) );
+    *pwStop  = Abc_MinInt( nWords, nAlign * (int)((word)nBlocks * (iThread + 1) / nThreads) );
+}
+void Gia_ManSimRunThreads( void * (*pFunc)(void *), void * pThData, int nSize, int nThreads )
+{
+    int i;
+#ifdef ABC_USE_PTHREADS
+    pthread_t WorkerThread[GIA_SIM_THR_MAX];
+    int status;
+    assert( nThreads <= GIA_SIM_THR_MAX );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        status = pthread_create( WorkerThread + i, NULL, pFunc, (void *)((char *)pThData + i * nSize) );  assert( status == 0 );
+    }
+    for ( i = 0; i < nThreads; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+    }
+#else
+    for ( i = 0; i < nThreads; i++ )
+        pFunc( (void *)((char *)pThData + i * nSize) );
+#endif
+}
+
 /**Function*************************************************************
 
   Synopsis    [This procedure sets default parameters.]
@@ -173,6 +238,7 @@ void Gia_ManSimSetDefaultParams( Gia_ParSim_t * p )
     p->fCheckMiter  =   0;    // check if miter outputs are non-zero 
     p->fVerbose     =   0;    // enables verbose output
     p->iOutFail     =  -1;    // index of the failed output
+    p->nThreads     =   1;    // the number of simulation threads
 }
 
 /**Function*************************************************************
@@ -346,12 +412,12 @@ static inline void Gia_ManSimInfoCopy( Gia_ManSim_t * p, unsigned * pInfo, unsig
   SeeAlso     []
 
 ***********************************************************************/
-static inline void Gia_ManSimulateCi( Gia_ManSim_t * p, Gia_Obj_t * pObj, int iCi )
+static inline void Gia_ManSimulateCi( Gia_ManSim_t * p, Gia_Obj_t * pObj, int iCi, int wStart, int wStop )
 {
     unsigned * pInfo  = Gia_SimData( p, Gia_ObjValue(pObj) );
     unsigned * pInfo0 = Gia_SimDataCi( p, iCi );
     int w;
-    for ( w = p->nWords-1; w >= 0; w-- )
+    for ( w = wStop-1; w >= wStart; w-- )
         pInfo[w] = pInfo0[w];
 }
 
@@ -366,16 +432,16 @@ static inline void Gia_ManSimulateCi( Gia_ManSim_t * p, Gia_Obj_t * pObj, int iC
   SeeAlso     []
 
 ***********************************************************************/
-static inline void Gia_ManSimulateCo( Gia_ManSim_t * p, int iCo, Gia_Obj_t * pObj )
+static inline void Gia_ManSimulateCo( Gia_ManSim_t * p, int iCo, Gia_Obj_t * pObj, int wStart, int wStop )
 {
     unsigned * pInfo  = Gia_SimDataCo( p, iCo );
     unsigned * pInfo0 = Gia_SimData( p, Gia_ObjDiff0(pObj) );
     int w;
     if ( Gia_ObjFaninC0(pObj) )
-        for ( w = p->nWords-1; w >= 0; w-- )
+        for ( w = wStop-1; w >= wStart; w-- )
             pInfo[w] = ~pInfo0[w];
     else 
-        for ( w = p->nWords-1; w >= 0; w-- )
+        for ( w = wStop-1; w >= wStart; w-- )
             pInfo[w] = pInfo0[w];
 }
 
@@ -390,7 +456,7 @@ static inline void Gia_ManSimulateCo( Gia_ManSim_t * p, int iCo, Gia_Obj_t * pOb
   SeeAlso     []
 
 ***********************************************************************/
-static inline void Gia_ManSimulateNode( Gia_ManSim_t * p, Gia_Obj_t * pObj )
+static inline void Gia_ManSimulateNode( Gia_ManSim_t * p, Gia_Obj_t * pObj, int wStart, int wStop )
 {
     unsigned * pInfo  = Gia_SimData( p, Gia_ObjValue(pObj) );
     unsigned * pInfo0 = Gia_SimData( p, Gia_ObjDiff0(pObj) );
@@ -399,19 +465,19 @@ static inline void Gia_ManSimulateNode( Gia_ManSim_t * p, Gia_Obj_t * pObj )
     if ( Gia_ObjFaninC0(pObj) )
     {
         if (  Gia_ObjFaninC1(pObj) )
-            for ( w = p->nWords-1; w >= 0; w-- )
+            for ( w = wStop-1; w >= wStart; w-- )
                 pInfo[w] = ~(pInfo0[w] | pInfo1[w]);
         else 
-            for ( w = p->nWords-1; w >= 0; w-- )
+            for ( w = wStop-1; w >= wStart; w-- )
                 pInfo[w] = ~pInfo0[w] & pInfo1[w];
     }
     else 
     {
         if (  Gia_ObjFaninC1(pObj) )
-            for ( w = p->nWords-1; w >= 0; w-- )
+            for ( w = wStop-1; w >= wStart; w-- )
                 pInfo[w] = pInfo0[w] & ~pInfo1[w];
         else 
-            for ( w = p->nWords-1; w >= 0; w-- )
+            for ( w = wStop-1; w >= wStart; w-- )
                 pInfo[w] = pInfo0[w] & pInfo1[w];
     }
 }
@@ -464,43 +530,69 @@ void Gia_ManSimInfoTransfer( Gia_ManSim_t * p )
 
 /**Function*************************************************************
 
-  Synopsis    []
+  Synopsis    [Simulates one round.]
 
-  Description []
+  Description [The CI patterns are generated serially by the caller. If 
+  there are several threads, each of them simulates the whole AIG on its 
+  own range of words.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-void Gia_ManSimulateRound( Gia_ManSim_t * p )
+void Gia_ManSimulateRoundRange( Gia_ManSim_t * p, int wStart, int wStop )
 {
     Gia_Obj_t * pObj;
-    int i, iCis = 0, iCos = 0;
+    unsigned * pInfo = Gia_SimData(p, 0);
+    int i, w, iCis = 0, iCos = 0;
     assert( p->pAig->nFront > 0 );
     assert( Gia_ManConst0(p->pAig)->Value == 0 );
-    Gia_ManSimInfoZero( p, Gia_SimData(p, 0) );
+    for ( w = wStop-1; w >= wStart; w-- )
+        pInfo[w] = 0;
     Gia_ManForEachObj1( p->pAig, pObj, i )
     {
         if ( Gia_ObjIsAndOrConst0(pObj) )
         {
             assert( Gia_ObjValue(pObj) < p->pAig->nFront );
-            Gia_ManSimulateNode( p, pObj );
+            Gia_ManSimulateNode( p, pObj, wStart, wStop );
         }
         else if ( Gia_ObjIsCo(pObj) )
         {
             assert( Gia_ObjValue(pObj) == GIA_NONE );
-            Gia_ManSimulateCo( p, iCos++, pObj );
+            Gia_ManSimulateCo( p, iCos++, pObj, wStart, wStop );
         }
         else // if ( Gia_ObjIsCi(pObj) )
         {
             assert( Gia_ObjValue(pObj) < p->pAig->nFront );
-            Gia_ManSimulateCi( p, pObj, iCis++ );
+            Gia_ManSimulateCi( p, pObj, iCis++, wStart, wStop );
         }
     }
     assert( Gia_ManCiNum(p->pAig) == iCis );
     assert( Gia_ManCoNum(p->pAig) == iCos );
 }
+void * Gia_ManSimulateRoundThread( void * pArg )
+{
+    Gia_ManSimThData_t * pThData = (Gia_ManSimThData_t *)pArg;
+    Gia_ManSimulateRoundRange( pThData->p, pThData->wStart, pThData->wStop );
+    return NULL;
+}
+void Gia_ManSimulateRound( Gia_ManSim_t * p )
+{
+    Gia_ManSimThData_t ThData[GIA_SIM_THR_MAX];
+    int i, nThreads = Gia_ManSimShardNum( p->nWords, p->pPars->nThreads, 64 );
+    if ( nThreads == 1 )
+    {
+        Gia_ManSimulateRoundRange( p, 0, p->nWords );
+        return;
+    }
+    for ( i = 0; i < nThreads; i++ )
+    {
+        ThData[i].p = p;
+        Gia_ManSimShardRange( p->nWords, nThreads, 64, i, &ThData[i].wStart, &ThData[i].wStop );
+    }
+    Gia_ManSimRunThreads( Gia_ManSimulateRoundThread, ThData, sizeof(Gia_ManSimThData_t), nThreads );
+}
 
 /**Function*************************************************************
 
@@ -600,9 +692,9 @@ int Gia_ManSimSimulate( Gia_Man_t * pAig, Gia_ParSim_t * pPars )
 {
     extern int Gia_ManSimSimulateEquiv( Gia_Man_t * pAig, Gia_ParSim_t * pPars );
     Gia_ManSim_t * p;
-    abctime clkTotal = Abc_Clock();
+    abctime clkTotal = Abc_ClockWall();
     int i, iOut, iPat, RetValue = 0;
-    abctime nTimeToStop = pPars->TimeLimit ? pPars->TimeLimit * CLOCKS_PER_SEC + Abc_Clock(): 0;
+    abctime nTimeToStop = pPars->TimeLimit ? pPars->TimeLimit * CLOCKS_PER_SEC + Abc_ClockWall(): 0;
     if ( pAig->pReprs && pAig->pNexts )
         return Gia_ManSimSimulateEquiv( pAig, pPars );
     ABC_FREE( pAig->pCexSeq );
@@ -615,7 +707,7 @@ int Gia_ManSimSimulate( Gia_Man_t * pAig, Gia_ParSim_t * pPars )
         if ( pPars->fVerbose )
         {
             Abc_Print( 1, "Frame %4d out of %4d and timeout %3d sec. ", i+1, pPars->nIters, pPars->TimeLimit );
-            Abc_Print( 1, "Time = %7.2f sec\r", (1.0*Abc_Clock()-clkTotal)/CLOCKS_PER_SEC );
+            Abc_Print( 1, "Time = %7.2f sec\r", (1.0*Abc_ClockWall()-clkTotal)/CLOCKS_PER_SEC );
         }
         if ( pPars->fCheckMiter && Gia_ManCheckPos( p, &iOut, &iPat ) )
         {
@@ -639,7 +731,7 @@ int Gia_ManSimSimulate( Gia_Man_t * pAig, Gia_ParSim_t * pPars )
             RetValue = 1;
             break;
         }
-        if ( Abc_Clock() > nTimeToStop )
+        if ( Abc_ClockWall() > nTimeToStop )
         {
             i++;
             break;
@@ -650,7 +742,7 @@ int Gia_ManSimSimulate( Gia_Man_t * pAig, Gia_ParSim_t * pPars )
     Gia_ManSimDelete( p );
     if ( pAig->pCexSeq == NULL )
         Abc_Print( 1, "No bug detected after simulating %d frames with %d words.  ", i, pPars->nWords );
-    Abc_PrintTime( 1, "Time", Abc_Clock() - clkTotal );
+    Abc_PrintTime( 1, "Time", Abc_ClockWall() - clkTotal );
     return RetValue;
 }
 
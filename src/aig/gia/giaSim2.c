@@ -40,6 +40,14 @@ struct Gia_Sim2_t_
 
 static inline unsigned * Gia_Sim2Data( Gia_Sim2_t * p, int i )    { return p->pDataSim + i * p->nWords;    }
 
+typedef struct Gia_Sim2ThData_t_ Gia_Sim2ThData_t;
+struct Gia_Sim2ThData_t_
+{
+    Gia_Sim2_t *   p;
+    int            wStart;
+    int            wStop;
+};
+
 extern void Gia_ManResetRandom( Gia_ParSim_t * pPars );
 
 ////////////////////////////////////////////////////////////////////////
@@ -188,16 +196,16 @@ static inline void Gia_Sim2InfoCopy( Gia_Sim2_t * p, unsigned * pInfo, unsigned
   SeeAlso     []
 
 ***********************************************************************/
-static inline void Gia_Sim2SimulateCo( Gia_Sim2_t * p, Gia_Obj_t * pObj )
+static inline void Gia_Sim2SimulateCo( Gia_Sim2_t * p, Gia_Obj_t * pObj, int wStart, int wStop )
 {
     unsigned * pInfo  = Gia_Sim2Data( p, Gia_ObjValue(pObj) );
     unsigned * pInfo0 = Gia_Sim2Data( p, Gia_ObjFaninId0(pObj, Gia_ObjValue(pObj)) );
     int w;
     if ( Gia_ObjFaninC0(pObj) )
-        for ( w = p->nWords-1; w >= 0; w-- )
+        for ( w = wStop-1; w >= wStart; w-- )
             pInfo[w] = ~pInfo0[w];
     else 
-        for ( w = p->nWords-1; w >= 0; w-- )
+        for ( w = wStop-1; w >= wStart; w-- )
             pInfo[w] = pInfo0[w];
 }
 
@@ -212,7 +220,7 @@ static inline void Gia_Sim2SimulateCo( Gia_Sim2_t * p, Gia_Obj_t * pObj )
   SeeAlso     []
 
 ***********************************************************************/
-static inline void Gia_Sim2SimulateNode( Gia_Sim2_t * p, Gia_Obj_t * pObj )
+static inline void Gia_Sim2SimulateNode( Gia_Sim2_t * p, Gia_Obj_t * pObj, int wStart, int wStop )
 {
     unsigned * pInfo  = Gia_Sim2Data( p, Gia_ObjValue(pObj) );
     unsigned * pInfo0 = Gia_Sim2Data( p, Gia_ObjFaninId0(pObj, Gia_ObjValue(pObj)) );
@@ -221,19 +229,19 @@ static inline void Gia_Sim2SimulateNode( Gia_Sim2_t * p, Gia_Obj_t * pObj )
     if ( Gia_ObjFaninC0(pObj) )
     {
         if (  Gia_ObjFaninC1(pObj) )
-            for ( w = p->nWords-1; w >= 0; w-- )
+            for ( w = wStop-1; w >= wStart; w-- )
                 pInfo[w] = ~(pInfo0[w] | pInfo1[w]);
         else 
-            for ( w = p->nWords-1; w >= 0; w-- )
+            for ( w = wStop-1; w >= wStart; w-- )
                 pInfo[w] = ~pInfo0[w] & pInfo1[w];
     }
     else 
     {
         if (  Gia_ObjFaninC1(pObj) )
-            for ( w = p->nWords-1; w >= 0; w-- )
+            for ( w = wStop-1; w >= wStart; w-- )
                 pInfo[w] = pInfo0[w] & ~pInfo1[w];
         else 
-            for ( w = p->nWords-1; w >= 0; w-- )
+            for ( w = wStop-1; w >= wStart; w-- )
                 pInfo[w] = pInfo0[w] & pInfo1[w];
     }
 }
@@ -264,31 +272,58 @@ static inline void Gia_Sim2InfoTransfer( Gia_Sim2_t * p )
 
 /**Function*************************************************************
 
-  Synopsis    []
+  Synopsis    [Simulates one round.]
 
-  Description []
+  Description [The random PI patterns are generated serially, so that the
+  counter-example can be regenerated from the seed. The internal nodes are
+  simulated by the threads, each on its own range of words. The classes
+  are refined by the caller after all threads are joined, using all words.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-static inline void Gia_Sim2SimulateRound( Gia_Sim2_t * p )
+static inline void Gia_Sim2SimulateRange( Gia_Sim2_t * p, int wStart, int wStop )
 {
     Gia_Obj_t * pObj;
     int i;
+    Gia_ManForEachAnd( p->pAig, pObj, i )
+    {
+        assert( Gia_ObjValue(pObj) == i );
+        Gia_Sim2SimulateNode( p, pObj, wStart, wStop );
+    }
+    Gia_ManForEachCo( p->pAig, pObj, i )
+        Gia_Sim2SimulateCo( p, pObj, wStart, wStop );
+}
+static void * Gia_Sim2SimulateThread( void * pArg )
+{
+    Gia_Sim2ThData_t * pThData = (Gia_Sim2ThData_t *)pArg;
+    Gia_Sim2SimulateRange( pThData->p, pThData->wStart, pThData->wStop );
+    return NULL;
+}
+static inline void Gia_Sim2SimulateRound( Gia_Sim2_t * p )
+{
+    Gia_Sim2ThData_t ThData[GIA_SIM_THR_MAX];
+    Gia_Obj_t * pObj;
+    int i, nThreads;
     pObj = Gia_ManConst0(p->pAig);
     assert( Gia_ObjValue(pObj) == 0 );
     Gia_Sim2InfoZero( p, Gia_Sim2Data(p, Gia_ObjValue(pObj)) );
     Gia_ManForEachPi( p->pAig, pObj, i )
         Gia_Sim2InfoRandom( p, Gia_Sim2Data(p, Gia_ObjValue(pObj)) );
-    Gia_ManForEachAnd( p->pAig, pObj, i )
+    nThreads = Gia_ManSimShardNum( p->nWords, p->pPars->nThreads, 64 );
+    if ( nThreads == 1 )
     {
-        assert( Gia_ObjValue(pObj) == i );
-        Gia_Sim2SimulateNode( p, pObj );
+        Gia_Sim2SimulateRange( p, 0, p->nWords );
+        return;
     }
-    Gia_ManForEachCo( p->pAig, pObj, i )
-        Gia_Sim2SimulateCo( p, pObj );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        ThData[i].p = p;
+        Gia_ManSimShardRange( p->nWords, nThreads, 64, i, &ThData[i].wStart, &ThData[i].wStop );
+    }
+    Gia_ManSimRunThreads( Gia_Sim2SimulateThread, ThData, sizeof(Gia_Sim2ThData_t), nThreads );
 }
 
 
@@ -639,9 +674,9 @@ int Gia_ManSimSimulateEquiv( Gia_Man_t * pAig, Gia_ParSim_t * pPars )
 {
     Gia_Sim2_t * p;
     Gia_Obj_t * pObj;
-    abctime clkTotal = Abc_Clock();
+    abctime clkTotal = Abc_ClockWall();
     int i, RetValue = 0, iOut, iPat;
-    abctime nTimeToStop = pPars->TimeLimit ? pPars->TimeLimit * CLOCKS_PER_SEC + Abc_Clock(): 0;
+    abctime nTimeToStop = pPars->TimeLimit ? pPars->TimeLimit * CLOCKS_PER_SEC + Abc_ClockWall(): 0;
     assert( pAig->pReprs && pAig->pNexts );
     ABC_FREE( pAig->pCexSeq );
     p = Gia_Sim2Create( pAig, pPars );
@@ -656,7 +691,7 @@ int Gia_ManSimSimulateEquiv( Gia_Man_t * pAig, Gia_ParSim_t * pPars )
             Abc_Print( 1, "Frame %4d out of %4d and timeout %3d sec. ", i+1, pPars->nIters, pPars->TimeLimit );
             if ( pAig->pReprs && pAig->pNexts )
                 Abc_Print( 1, "Lits = %4d. ", Gia_ManEquivCountLitsAll(pAig) );
-            Abc_Print( 1, "Time = %7.2f sec\r", (1.0*Abc_Clock()-clkTotal)/CLOCKS_PER_SEC );
+            Abc_Print( 1, "Time = %7.2f sec\r", (1.0*Abc_ClockWall()-clkTotal)/CLOCKS_PER_SEC );
         }
         if ( pPars->fCheckMiter && Gia_Sim2CheckPos( p, &iOut, &iPat ) )
         {
@@ -682,7 +717,7 @@ int Gia_ManSimSimulateEquiv( Gia_Man_t * pAig, Gia_ParSim_t * pPars )
         }
         if ( pAig->pReprs && pAig->pNexts )
             Gia_Sim2InfoRefineEquivs( p );
-        if ( Abc_Clock() > nTimeToStop )
+        if ( Abc_ClockWall() > nTimeToStop )
         {
             i++;
             break;
@@ -693,7 +728,7 @@ int Gia_ManSimSimulateEquiv( Gia_Man_t * pAig, Gia_ParSim_t * pPars )
     Gia_Sim2Delete( p );
     if ( pAig->pCexSeq == NULL )
         Abc_Print( 1, "No bug detected after simulating %d frames with %d words.  ", i, pPars->nWords );
-    Abc_PrintTime( 1, "Time", Abc_Clock() - clkTotal );
+    Abc_PrintTime( 1, "Time", Abc_ClockWall() - clkTotal );
     return RetValue;
 }
 
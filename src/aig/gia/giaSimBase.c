@@ -23,6 +23,11 @@
 #include "misc/extra/extra.h"
 //#include <immintrin.h>
 
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define GIA_SIM_X86
+#include <immintrin.h>
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -121,19 +126,241 @@ static inline void Gia_ManSimPatSimNot( Gia_Man_t * p, int i, Gia_Obj_t * pObj,
     for ( w = 0; w < nWords; w++ )
         pSims[w]   = ~pSims[w];
 }
-Vec_Wrd_t * Gia_ManSimPatSim( Gia_Man_t * pGia )
+/**Function*************************************************************
+
+  Synopsis    [SIMD simulation kernel.]
+
+  Description [The AND nodes are packed in topological order into a flat 
+  array of (node, fanin literal, fanin literal) triples, so that the kernel 
+  streams through contiguous ints instead of Gia_Obj_t records. The words 
+  of each node are computed in AVX2 or AVX-512 blocks of 4 or 8 words, 
+  selected at runtime using cpuid, with a scalar fallback. The simulation 
+  can be restricted to a range of words of each node.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef void (*Gia_SimPatBlockFunc_t)( word * pOut, word * p0, word * p1, word c0, word c1, int fXor, int nWords );
+
+typedef struct Gia_SimPatThData_t_ Gia_SimPatThData_t;
+struct Gia_SimPatThData_t_
+{
+    Gia_Man_t *    p;
+    Vec_Int_t *    vOrder;
+    Vec_Wrd_t *    vSims;
+    int            nWords;
+    int            wStart;
+    int            wStop;
+};
+
+static void Gia_ManSimPatBlockScalar( word * pOut, word * p0, word * p1, word c0, word c1, int fXor, int nWords )
+{
+    int w;
+    if ( fXor )
+        for ( w = 0; w < nWords; w++ )
+            pOut[w] = (p0[w] ^ c0) ^ (p1[w] ^ c1);
+    else
+        for ( w = 0; w < nWords; w++ )
+            pOut[w] = (p0[w] ^ c0) & (p1[w] ^ c1);
+}
+#ifdef GIA_SIM_X86
+__attribute__((target("avx2")))
+static void Gia_ManSimPatBlockAvx2( word * pOut, word * p0, word * p1, word c0, word c1, int fXor, int nWords )
+{
+    __m256i M0 = _mm256_set1_epi64x( (long long)c0 );
+    __m256i M1 = _mm256_set1_epi64x( (long long)c1 );
+    int w = 0;
+    if ( fXor )
+        for ( ; w + 4 <= nWords; w += 4 )
+        {
+            __m256i A = _mm256_xor_si256( _mm256_loadu_si256((__m256i *)(p0 + w)), M0 );
+            __m256i B = _mm256_xor_si256( _mm256_loadu_si256((__m256i *)(p1 + w)), M1 );
+            _mm256_storeu_si256( (__m256i *)(pOut + w), _mm256_xor_si256(A, B) );
+        }
+    else
+        for ( ; w + 4 <= nWords; w += 4 )
+        {
+            __m256i A = _mm256_xor_si256( _mm256_loadu_si256((__m256i *)(p0 + w)), M0 );
+            __m256i B = _mm256_xor_si256( _mm256_loadu_si256((__m256i *)(p1 + w)), M1 );
+            _mm256_storeu_si256( (__m256i *)(pOut + w), _mm256_and_si256(A, B) );
+        }
+    if ( w < nWords )
+        Gia_ManSimPatBlockScalar( pOut + w, p0 + w, p1 + w, c0, c1, fXor, nWords - w );
+}
+__attribute__((target("avx512f")))
+static void Gia_ManSimPatBlockAvx512( word * pOut, word * p0, word * p1, word c0, word c1, int fXor, int nWords )
+{
+    __m512i M0 = _mm512_set1_epi64( (long long)c0 );
+    __m512i M1 = _mm512_set1_epi64( (long long)c1 );
+    int w = 0;
+    if ( fXor )
+        for ( ; w + 8 <= nWords; w += 8 )
+        {
+            __m512i A = _mm512_xor_si512( _mm512_loadu_si512((void *)(p0 + w)), M0 );
+            __m512i B = _mm512_xor_si512( _mm512_loadu_si512((void *)(p1 + w)), M1 );
+            _mm512_storeu_si512( (void *)(pOut + w), _mm512_xor_si512(A, B) );
+        }
+    else
+        for ( ; w + 8 <= nWords; w += 8 )
+        {
+            __m512i A = _mm512_xor_si512( _mm512_loadu_si512((void *)(p0 + w)), M0 );
+            __m512i B = _mm512_xor_si512( _mm512_loadu_si512((void *)(p1 + w)), M1 );
+            _mm512_storeu_si512( (void *)(pOut + w), _mm512_and_si512(A, B) );
+        }
+    if ( w < nWords )
+        Gia_ManSimPatBlockScalar( pOut + w, p0 + w, p1 + w, c0, c1, fXor, nWords - w );
+}
+#endif
+static Gia_SimPatBlockFunc_t Gia_ManSimPatBlockFunc( char ** ppName )
+{
+#ifdef GIA_SIM_X86
+    __builtin_cpu_init();
+    if ( __builtin_cpu_supports("avx512f") )
+    {
+        if ( ppName ) *ppName = (char *)"AVX-512";
+        return Gia_ManSimPatBlockAvx512;
+    }
+    if ( __builtin_cpu_supports("avx2") )
+    {
+        if ( ppName ) *ppName = (char *)"AVX2";
+        return Gia_ManSimPatBlockAvx2;
+    }
+#endif
+    if ( ppName ) *ppName = (char *)"scalar";
+    return Gia_ManSimPatBlockScalar;
+}
+Vec_Int_t * Gia_ManSimPatOrder( Gia_Man_t * p )
+{
+    Gia_Obj_t * pObj; int i;
+    Vec_Int_t * vOrder = Vec_IntAlloc( 3 * Gia_ManAndNum(p) );
+    Gia_ManForEachAnd( p, pObj, i )
+    {
+        Vec_IntPush( vOrder, Gia_ObjIsXor(pObj) ? -i : i );
+        Vec_IntPush( vOrder, Gia_ObjFaninLit0(pObj, i) );
+        Vec_IntPush( vOrder, Gia_ObjFaninLit1(pObj, i) );
+    }
+    return vOrder;
+}
+static void Gia_ManSimPatSimNodes( Gia_Man_t * p, Gia_SimPatBlockFunc_t pFunc, int * pOrder, int nOrder, word * pSims, int nStride, int nBlock )
+{
+    word pComps[2] = { 0, ~(word)0 };
+    Gia_Obj_t * pObj;
+    int k, i, w;
+    for ( k = 0; k < nOrder; k += 3 )
+    {
+        int Id = Abc_AbsInt( pOrder[k] );
+        int iLit0 = pOrder[k+1], iLit1 = pOrder[k+2];
+        pFunc( pSims + (size_t)nStride*Id, pSims + (size_t)nStride*Abc_Lit2Var(iLit0), pSims + (size_t)nStride*Abc_Lit2Var(iLit1), 
+            pComps[Abc_LitIsCompl(iLit0)], pComps[Abc_LitIsCompl(iLit1)], pOrder[k] < 0, nBlock );
+    }
+    Gia_ManForEachCo( p, pObj, i )
+    {
+        word * pSims0 = pSims + (size_t)nStride*Gia_ObjFaninId0p(p, pObj);
+        word * pSims2 = pSims + (size_t)nStride*Gia_ObjId(p, pObj);
+        word Diff0 = pComps[Gia_ObjFaninC0(pObj)];
+        for ( w = 0; w < nBlock; w++ )
+            pSims2[w] = pSims0[w] ^ Diff0;
+    }
+}
+void Gia_ManSimPatSimRange( Gia_Man_t * p, Vec_Int_t * vOrder, int nWords, Vec_Wrd_t * vSims, int wStart, int wStop )
+{
+    Gia_SimPatBlockFunc_t pFunc = Gia_ManSimPatBlockFunc( NULL );
+    Gia_ManSimPatSimNodes( p, pFunc, Vec_IntArray(vOrder), Vec_IntSize(vOrder), Vec_WrdArray(vSims) + wStart, nWords, wStop - wStart );
+}
+void * Gia_ManSimPatSimThread( void * pArg )
+{
+    Gia_SimPatThData_t * pThData = (Gia_SimPatThData_t *)pArg;
+    Gia_ManSimPatSimRange( pThData->p, pThData->vOrder, pThData->nWords, pThData->vSims, pThData->wStart, pThData->wStop );
+    return NULL;
+}
+void Gia_ManSimPatSimPar( Gia_Man_t * p, Vec_Int_t * vOrder, int nWords, Vec_Wrd_t * vSims, int nThreads )
+{
+    Gia_SimPatThData_t ThData[GIA_SIM_THR_MAX];
+    int i;
+    nThreads = Gia_ManSimShardNum( nWords, nThreads, 64 );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        ThData[i].p      = p;
+        ThData[i].vOrder = vOrder;
+        ThData[i].vSims  = vSims;
+        ThData[i].nWords = nWords;
+        Gia_ManSimShardRange( nWords, nThreads, 64, i, &ThData[i].wStart, &ThData[i].wStop );
+    }
+    Gia_ManSimRunThreads( Gia_ManSimPatSimThread, ThData, sizeof(Gia_SimPatThData_t), nThreads );
+}
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Wrd_t * Gia_ManSimPatSimOpt( Gia_Man_t * pGia, int fKernel, int nThreads )
 {
     Gia_Obj_t * pObj;
     int i, nWords = Vec_WrdSize(pGia->vSimsPi) / Gia_ManCiNum(pGia);
     Vec_Wrd_t * vSims = Vec_WrdStart( Gia_ManObjNum(pGia) * nWords );
     assert( Vec_WrdSize(pGia->vSimsPi) % Gia_ManCiNum(pGia) == 0 );
     Gia_ManSimPatAssignInputs( pGia, nWords, vSims, pGia->vSimsPi );
-    Gia_ManForEachAnd( pGia, pObj, i ) 
-        Gia_ManSimPatSimAnd( pGia, i, pObj, nWords, vSims );
-    Gia_ManForEachCo( pGia, pObj, i )
-        Gia_ManSimPatSimPo( pGia, Gia_ObjId(pGia, pObj), pObj, nWords, vSims );
+    if ( fKernel || nThreads > 1 )
+    {
+        Vec_Int_t * vOrder = Gia_ManSimPatOrder( pGia );
+        Gia_ManSimPatSimPar( pGia, vOrder, nWords, vSims, nThreads );
+        Vec_IntFree( vOrder );
+    }
+    else
+    {
+        Gia_ManForEachAnd( pGia, pObj, i ) 
+            Gia_ManSimPatSimAnd( pGia, i, pObj, nWords, vSims );
+        Gia_ManForEachCo( pGia, pObj, i )
+            Gia_ManSimPatSimPo( pGia, Gia_ObjId(pGia, pObj), pObj, nWords, vSims );
+    }
     return vSims;
 }
+Vec_Wrd_t * Gia_ManSimPatSim( Gia_Man_t * pGia )
+{
+    return Gia_ManSimPatSimOpt( pGia, 0, 1 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Measures the throughput of pattern simulation.]
+
+  Description [Simulates nWords random words of the combinational logic 
+  once using the given kernel and number of threads, and prints the 
+  throughput in node-words per second of wall-clock time.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManSimPatBench( Gia_Man_t * pGia, int nWords, int fKernel, int nThreads )
+{
+    Vec_Wrd_t * vSimsPi = pGia->vSimsPi, * vSims;
+    word nNodeWords = (word)(Gia_ManAndNum(pGia) + Gia_ManCoNum(pGia)) * nWords;
+    char * pName = (char *)"scalar per-node";
+    abctime clk;
+    if ( fKernel || nThreads > 1 )
+        Gia_ManSimPatBlockFunc( &pName );
+    pGia->vSimsPi = Vec_WrdStartRandom( Gia_ManCiNum(pGia) * nWords );
+    clk = Abc_ClockWall();
+    vSims = Gia_ManSimPatSimOpt( pGia, fKernel, nThreads );
+    clk = Abc_ClockWall() - clk;
+    Vec_WrdFree( vSims );
+    Vec_WrdFree( pGia->vSimsPi );
+    pGia->vSimsPi = vSimsPi;
+    printf( "Kernel = %s.  Threads = %d.  Node-words = %.0f.  ", pName, Abc_MaxInt(nThreads, 1), (double)nNodeWords );
+    if ( clk > 0 )
+        printf( "Throughput = %.2f G node-words/sec.  ", 1.0 * nNodeWords / (1000000000.0 * clk / CLOCKS_PER_SEC) );
+    Abc_PrintTime( 1, "Time", clk );
+}
 void Gia_ManSimPatResim( Gia_Man_t * pGia, Vec_Int_t * vObjs, int nWords, Vec_Wrd_t * vSims )
 {
     Gia_Obj_t * pObj; int i;
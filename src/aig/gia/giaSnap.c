@@ -0,0 +1,370 @@
+/**CFile****************************************************************
+
+  FileName    [giaSnap.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Compressed in-memory snapshots of the AIG.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: giaSnap.c,v 1.00 2026/10/17 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "gia.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// the object kinds recorded as runs in the snapshot
+#define GIA_SNAP_CI   0
+#define GIA_SNAP_AND  1
+#define GIA_SNAP_CO   2
+
+static inline void Gia_SnapWriteStr( Vec_Str_t * vData, char * pStr )
+{
+    int Len = pStr ? strlen(pStr) : -1;
+    Gia_AigerWriteUnsigned( vData, Len + 1 );
+    if ( Len > 0 )
+        Vec_StrPushBuffer( vData, pStr, Len );
+}
+static inline char * Gia_SnapReadStr( unsigned char ** ppPos )
+{
+    int Len = (int)Gia_AigerReadUnsigned( ppPos ) - 1;
+    char * pStr;
+    if ( Len < 0 )
+        return NULL;
+    pStr = ABC_ALLOC( char, Len + 1 );
+    memcpy( pStr, *ppPos, (size_t)Len );
+    pStr[Len] = 0;
+    *ppPos += Len;
+    return pStr;
+}
+static inline void Gia_SnapWriteVec( Vec_Str_t * vData, Vec_Int_t * vVec )
+{
+    int i, Entry;
+    Gia_AigerWriteUnsigned( vData, vVec ? Vec_IntSize(vVec) + 1 : 0 );
+    if ( vVec )
+        Vec_IntForEachEntry( vVec, Entry, i )
+            Gia_AigerWriteUnsigned( vData, Entry >= 0 ? 2*Entry : -2*Entry-1 );
+}
+static inline Vec_Int_t * Gia_SnapReadVec( unsigned char ** ppPos )
+{
+    int i, Size = (int)Gia_AigerReadUnsigned( ppPos ) - 1;
+    Vec_Int_t * vVec;
+    if ( Size < 0 )
+        return NULL;
+    vVec = Vec_IntAlloc( Size );
+    for ( i = 0; i < Size; i++ )
+    {
+        unsigned x = Gia_AigerReadUnsigned( ppPos );
+        Vec_IntPush( vVec, (x & 1) ? -(int)(x >> 1)-1 : (int)(x >> 1) );
+    }
+    return vVec;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the AIG can be stored in the compressed form.]
+
+  Description [The compressed form covers the AIG structure, the LUT
+  mapping, the register classes and initial values, which is what
+  Gia_ManDupWithAttributes() preserves for the usual mapped AIGs.
+  Other AIGs are kept as uncompressed copies.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_SnapCanCompress( Gia_Man_t * p )
+{
+    return p->pMuxes == NULL && p->pSibls == NULL && p->nBufs == 0 &&
+        p->vCellMapping == NULL && p->vPacking == NULL && p->pManTime == NULL &&
+        p->pAigExtra == NULL && p->vConfigs == NULL && p->pCellStr == NULL &&
+        p->pCexSeq == NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Encodes the AIG into the byte stream.]
+
+  Description [Objects are written in the order of their IDs, so that
+  the decoded AIG has the same IDs and the mapping can be stored as is.
+  The object kinds are written as runs, which for the usual order of CIs,
+  internal nodes and COs takes three runs. The fanins of the internal
+  nodes are written as in the binary AIGER format: the difference between
+  the node literal and the larger fanin literal, followed by the difference
+  between the fanin literals, using the same 7-bit variable-length code.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Str_t * Gia_SnapEncode( Gia_Man_t * p )
+{
+    Vec_Str_t * vData = Vec_StrAlloc( 3 * Gia_ManObjNum(p) );
+    Vec_Int_t * vRuns = Vec_IntAlloc( 16 );
+    Gia_Obj_t * pObj;
+    int i, k, Kind, KindPrev = -1, iFan, iPrev;
+    // collect runs of objects of the same kind
+    Gia_ManForEachObj1( p, pObj, i )
+    {
+        Kind = Gia_ObjIsCi(pObj) ? GIA_SNAP_CI : (Gia_ObjIsAnd(pObj) ? GIA_SNAP_AND : GIA_SNAP_CO);
+        if ( Kind != KindPrev )
+            Vec_IntPushTwo( vRuns, Kind, 0 );
+        Vec_IntAddToEntry( vRuns, Vec_IntSize(vRuns)-1, 1 );
+        KindPrev = Kind;
+    }
+    Gia_AigerWriteUnsigned( vData, Gia_ManObjNum(p) );
+    Gia_AigerWriteUnsigned( vData, Gia_ManRegNum(p) );
+    Gia_AigerWriteUnsigned( vData, Vec_IntSize(vRuns) / 2 );
+    Vec_IntForEachEntry( vRuns, Kind, i )
+        Gia_AigerWriteUnsigned( vData, Kind );
+    Vec_IntFree( vRuns );
+    // write the fanins
+    Gia_ManForEachObj1( p, pObj, i )
+    {
+        if ( Gia_ObjIsAnd(pObj) )
+        {
+            int uLit  = Abc_Var2Lit( i, 0 );
+            int uLit0 = Gia_ObjFaninLit0( pObj, i );
+            int uLit1 = Gia_ObjFaninLit1( pObj, i );
+            assert( uLit0 <= uLit1 );
+            Gia_AigerWriteUnsigned( vData, uLit  - uLit1 );
+            Gia_AigerWriteUnsigned( vData, uLit1 - uLit0 );
+        }
+        else if ( Gia_ObjIsCo(pObj) )
+            Gia_AigerWriteUnsigned( vData, Abc_Var2Lit(i, 0) - Gia_ObjFaninLit0(pObj, i) );
+    }
+    // write the mapping
+    Gia_AigerWriteUnsigned( vData, Gia_ManHasMapping(p) ? Gia_ManLutNum(p) + 1 : 0 );
+    if ( Gia_ManHasMapping(p) )
+    {
+        iPrev = 0;
+        Gia_ManForEachLut( p, i )
+        {
+            Gia_AigerWriteUnsigned( vData, i - iPrev );
+            Gia_AigerWriteUnsigned( vData, Gia_ObjLutSize(p, i) );
+            Gia_LutForEachFanin( p, i, iFan, k )
+            {
+                assert( iFan < i );
+                Gia_AigerWriteUnsigned( vData, i - iFan );
+            }
+            iFan = Gia_ObjLutMuxId( p, i );
+            Gia_AigerWriteUnsigned( vData, Abc_Var2Lit(i - Abc_AbsInt(iFan), iFan < 0) );
+            iPrev = i;
+        }
+    }
+    // write the attributes
+    Gia_SnapWriteStr( vData, p->pName );
+    Gia_SnapWriteStr( vData, p->pSpec );
+    Gia_SnapWriteVec( vData, p->vRegClasses );
+    Gia_SnapWriteVec( vData, p->vRegInits );
+    Gia_AigerWriteUnsigned( vData, p->nAnd2Delay );
+    return vData;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Decodes the AIG from the byte stream.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Gia_SnapDecode( Vec_Str_t * vData )
+{
+    unsigned char * pPos = (unsigned char *)Vec_StrArray( vData );
+    Gia_Man_t * pNew;
+    Vec_Int_t * vRuns;
+    int i, k, r, nObjs, nRegs, nRuns, iObj = 1, nLuts, iLut = 0, nSize, Entry;
+    nObjs = Gia_AigerReadUnsigned( &pPos );
+    nRegs = Gia_AigerReadUnsigned( &pPos );
+    nRuns = Gia_AigerReadUnsigned( &pPos );
+    vRuns = Vec_IntAlloc( 2 * nRuns );
+    for ( r = 0; r < 2 * nRuns; r++ )
+        Vec_IntPush( vRuns, Gia_AigerReadUnsigned(&pPos) );
+    pNew = Gia_ManStart( nObjs );
+    for ( r = 0; r < nRuns; r++ )
+    {
+        int Kind = Vec_IntEntry( vRuns, 2*r );
+        int nNum = Vec_IntEntry( vRuns, 2*r+1 );
+        for ( k = 0; k < nNum; k++, iObj++ )
+        {
+            if ( Kind == GIA_SNAP_CI )
+                Gia_ManAppendCi( pNew );
+            else if ( Kind == GIA_SNAP_AND )
+            {
+                int uLit1 = Abc_Var2Lit( iObj, 0 ) - Gia_AigerReadUnsigned( &pPos );
+                int uLit0 = uLit1 - Gia_AigerReadUnsigned( &pPos );
+                Gia_ManAppendAnd( pNew, uLit0, uLit1 );
+            }
+            else
+                Gia_ManAppendCo( pNew, Abc_Var2Lit(iObj, 0) - Gia_AigerReadUnsigned(&pPos) );
+        }
+    }
+    Vec_IntFree( vRuns );
+    assert( Gia_ManObjNum(pNew) == nObjs );
+    Gia_ManSetRegNum( pNew, nRegs );
+    // read the mapping
+    nLuts = (int)Gia_AigerReadUnsigned( &pPos ) - 1;
+    if ( nLuts >= 0 )
+    {
+        pNew->vMapping = Vec_IntAlloc( 2 * nObjs );
+        Vec_IntFill( pNew->vMapping, nObjs, 0 );
+        for ( i = 0; i < nLuts; i++ )
+        {
+            iLut += Gia_AigerReadUnsigned( &pPos );
+            nSize = Gia_AigerReadUnsigned( &pPos );
+            Vec_IntWriteEntry( pNew->vMapping, iLut, Vec_IntSize(pNew->vMapping) );
+            Vec_IntPush( pNew->vMapping, nSize );
+            for ( k = 0; k < nSize; k++ )
+                Vec_IntPush( pNew->vMapping, iLut - (int)Gia_AigerReadUnsigned(&pPos) );
+            Entry = Gia_AigerReadUnsigned( &pPos );
+            Vec_IntPush( pNew->vMapping, Abc_LitIsCompl(Entry) ? -(iLut - Abc_Lit2Var(Entry)) : iLut - Abc_Lit2Var(Entry) );
+        }
+    }
+    // read the attributes
+    pNew->pName = Gia_SnapReadStr( &pPos );
+    pNew->pSpec = Gia_SnapReadStr( &pPos );
+    pNew->vRegClasses = Gia_SnapReadVec( &pPos );
+    pNew->vRegInits = Gia_SnapReadVec( &pPos );
+    pNew->nAnd2Delay = Gia_AigerReadUnsigned( &pPos );
+    assert( pPos == (unsigned char *)Vec_StrArray(vData) + Vec_StrSize(vData) );
+    return pNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Creates the snapshot of the AIG.]
+
+  Description [The snapshot does not depend on the AIG, which can be
+  modified or deleted afterwards. The AIG is decoded only when it is
+  requested by Gia_SnapRead().]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Snap_t * Gia_SnapStart( Gia_Man_t * p )
+{
+    Gia_Snap_t * pSnap = ABC_CALLOC( Gia_Snap_t, 1 );
+    pSnap->pName = Abc_UtilStrsav( Gia_ManName(p) );
+    pSnap->nPis  = Gia_ManPiNum(p);
+    pSnap->nPos  = Gia_ManPoNum(p);
+    pSnap->nRegs = Gia_ManRegNum(p);
+    pSnap->nAnds = Gia_ManAndNum(p);
+    pSnap->nLuts = Gia_ManHasMapping(p) ? Gia_ManLutNum(p) : 0;
+    if ( Gia_SnapCanCompress(p) )
+    {
+        pSnap->vData = Gia_SnapEncode( p );
+        // release the unused memory
+        pSnap->vData->pArray = ABC_REALLOC( char, pSnap->vData->pArray, Vec_StrSize(pSnap->vData) );
+        pSnap->vData->nCap   = Vec_StrSize(pSnap->vData);
+    }
+    else
+        pSnap->pGia = Gia_ManDupWithAttributes( p );
+    return pSnap;
+}
+void Gia_SnapStop( Gia_Snap_t * pSnap )
+{
+    if ( pSnap->vData )
+        Vec_StrFree( pSnap->vData );
+    if ( pSnap->pGia )
+        Gia_ManStop( pSnap->pGia );
+    ABC_FREE( pSnap->pName );
+    ABC_FREE( pSnap );
+}
+void Gia_SnapStopP( Gia_Snap_t ** ppSnap )
+{
+    if ( *ppSnap == NULL )
+        return;
+    Gia_SnapStop( *ppSnap );
+    *ppSnap = NULL;
+}
+
+void Gia_SnapStopVec( Vec_Ptr_t ** pvSnaps )
+{
+    Gia_Snap_t * pSnap;
+    int i;
+    if ( *pvSnaps == NULL )
+        return;
+    Vec_PtrForEachEntry( Gia_Snap_t *, *pvSnaps, pSnap, i )
+        Gia_SnapStop( pSnap );
+    Vec_PtrFreeP( pvSnaps );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns a new copy of the AIG stored in the snapshot.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Gia_SnapRead( Gia_Snap_t * pSnap )
+{
+    if ( pSnap->vData )
+        return Gia_SnapDecode( pSnap->vData );
+    return Gia_ManDupWithAttributes( pSnap->pGia );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the memory used by the snapshot in bytes.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+double Gia_SnapMemory( Gia_Snap_t * pSnap )
+{
+    if ( pSnap->vData )
+        return (double)sizeof(Gia_Snap_t) + Vec_StrCap(pSnap->vData);
+    return (double)sizeof(Gia_Snap_t) + Gia_ManMemory(pSnap->pGia) + (pSnap->pGia->vMapping ? 4.0 * Vec_IntCap(pSnap->pGia->vMapping) : 0);
+}
+void Gia_SnapPrint( Gia_Snap_t * pSnap )
+{
+    printf( "%-12s : ", pSnap->pName );
+    printf( "i/o =%7d/%7d  ", pSnap->nPis, pSnap->nPos );
+    if ( pSnap->nRegs )
+        printf( "ff =%7d  ", pSnap->nRegs );
+    printf( "and =%9d  ", pSnap->nAnds );
+    if ( pSnap->nLuts )
+        printf( "lut =%8d  ", pSnap->nLuts );
+    printf( "mem =%8.2f MB  %s\n", Gia_SnapMemory(pSnap) / (1 << 20), pSnap->vData ? "compressed" : "uncompressed" );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
@@ -188,6 +188,8 @@ struct Abc_Ntk_t_
     Vec_Int_t         vTravIds;      // trav IDs of the objects
     Mem_Fixed_t *     pMmObj;        // memory manager for objects
     Mem_Step_t *      pMmStep;       // memory manager for arrays
+    int *             pArena;        // the slab with the compacted fanin/fanout arrays
+    int               nArena;        // the number of entries in the slab
     void *            pManFunc;      // functionality manager (AIG manager, BDD manager, or memory manager for SOPs)
     Abc_ManTime_t *   pManTime;      // the timing manager (for mapped networks) stores arrival/required times for all nodes
     void *            pManCut;       // the cut manager (for AIGs) stores information about the cuts computed for the nodes
@@ -659,6 +661,9 @@ extern ABC_DLL void               Abc_ObjTransferFanout( Abc_Obj_t * pObjOld, Ab
 extern ABC_DLL void               Abc_ObjReplace( Abc_Obj_t * pObjOld, Abc_Obj_t * pObjNew );
 extern ABC_DLL void               Abc_ObjReplaceByConstant( Abc_Obj_t * pNode, int fConst1 );
 extern ABC_DLL int                Abc_ObjFanoutFaninNum( Abc_Obj_t * pFanout, Abc_Obj_t * pFanin );
+extern ABC_DLL int                Abc_NtkSetFanioArena( int fArena );
+extern ABC_DLL int                Abc_NtkReadFanioArena();
+extern ABC_DLL void               Abc_NtkCompactFanio( Abc_Ntk_t * pNtk );
 /*=== abcFanOrder.c ==========================================================*/
 extern ABC_DLL int                Abc_NtkMakeLegit( Abc_Ntk_t * pNtk );
 extern ABC_DLL void               Abc_NtkSortSops( Abc_Ntk_t * pNtk );
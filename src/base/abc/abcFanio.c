@@ -27,6 +27,11 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+// compacts the fanin/fanout arrays of the networks produced by Abc_NtkDup()
+static int s_fAbcFanioArena = 0;
+
+static inline int Abc_NtkArenaHas( Abc_Ntk_t * pNtk, int * pArray ) { return pArray >= pNtk->pArena && pArray < pNtk->pArena + pNtk->nArena; }
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -42,8 +47,9 @@ ABC_NAMESPACE_IMPL_START
   SeeAlso     []
 
 ***********************************************************************/
-static inline void Vec_IntPushMem( Mem_Step_t * pMemMan, Vec_Int_t * p, int Entry )
+static inline void Vec_IntPushMem( Abc_Ntk_t * pNtk, Vec_Int_t * p, int Entry )
 {
+    Mem_Step_t * pMemMan = pNtk->pMmStep;
     if ( p->nSize == p->nCap )
     {
         int * pArray;
@@ -59,10 +65,10 @@ static inline void Vec_IntPushMem( Mem_Step_t * pMemMan, Vec_Int_t * p, int Entr
         {
             for ( i = 0; i < p->nSize; i++ )
                 pArray[i] = p->pArray[i];
-            if ( pMemMan )
-                Mem_StepEntryRecycle( pMemMan, (char *)p->pArray, p->nCap * 4 );
-            else
+            if ( pMemMan == NULL )
                 ABC_FREE( p->pArray );
+            else if ( !Abc_NtkArenaHas(pNtk, p->pArray) ) // the slab is freed with the network
+                Mem_StepEntryRecycle( pMemMan, (char *)p->pArray, p->nCap * 4 );
         }
         p->nCap *= 2;
         p->pArray = pArray;
@@ -90,8 +96,8 @@ void Abc_ObjAddFanin( Abc_Obj_t * pObj, Abc_Obj_t * pFanin )
     assert( !Abc_ObjIsPi(pObj) && !Abc_ObjIsPo(pFaninR) );    // fanin of PI or fanout of PO
     assert( !Abc_ObjIsCo(pObj) || !Abc_ObjFaninNum(pObj) );  // CO with two fanins
     assert( !Abc_ObjIsNet(pObj) || !Abc_ObjFaninNum(pObj) ); // net with two fanins
-    Vec_IntPushMem( pObj->pNtk->pMmStep, &pObj->vFanins,     pFaninR->Id );
-    Vec_IntPushMem( pObj->pNtk->pMmStep, &pFaninR->vFanouts, pObj->Id    );
+    Vec_IntPushMem( pObj->pNtk, &pObj->vFanins,     pFaninR->Id );
+    Vec_IntPushMem( pObj->pNtk, &pFaninR->vFanouts, pObj->Id    );
     if ( Abc_ObjIsComplement(pFanin) )
         Abc_ObjSetFaninC( pObj, Abc_ObjFaninNum(pObj)-1 );
 }
@@ -206,7 +212,7 @@ void Abc_ObjPatchFanin( Abc_Obj_t * pObj, Abc_Obj_t * pFaninOld, Abc_Obj_t * pFa
         printf( " the fanouts of its old fanin %s...\n", Abc_ObjName(pFaninOld) );
 //        return;
     }
-    Vec_IntPushMem( pObj->pNtk->pMmStep, &pFaninNewR->vFanouts, pObj->Id );
+    Vec_IntPushMem( pObj->pNtk, &pFaninNewR->vFanouts, pObj->Id );
 }
 
 /**Function*************************************************************
@@ -269,8 +275,8 @@ Abc_Obj_t * Abc_ObjInsertBetween( Abc_Obj_t * pNodeIn, Abc_Obj_t * pNodeOut, Abc
     // create the new node
     pNodeNew = Abc_NtkCreateObj( pNodeIn->pNtk, Type );
     // add pNodeIn as fanin and pNodeOut as fanout
-    Vec_IntPushMem( pNodeNew->pNtk->pMmStep, &pNodeNew->vFanins,  pNodeIn->Id  );
-    Vec_IntPushMem( pNodeNew->pNtk->pMmStep, &pNodeNew->vFanouts, pNodeOut->Id );
+    Vec_IntPushMem( pNodeNew->pNtk, &pNodeNew->vFanins,  pNodeIn->Id  );
+    Vec_IntPushMem( pNodeNew->pNtk, &pNodeNew->vFanouts, pNodeOut->Id );
     // update the fanout of pNodeIn
     Vec_IntWriteEntry( &pNodeIn->vFanouts, iFanoutIndex, pNodeNew->Id );
     // update the fanin of pNodeOut
@@ -381,6 +387,75 @@ int Abc_ObjFanoutFaninNum( Abc_Obj_t * pFanout, Abc_Obj_t * pFanin )
 }
 
 
+/**Function*************************************************************
+
+  Synopsis    [Selects compaction of the networks produced by Abc_NtkDup().]
+
+  Description [Returns the previous setting.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_NtkSetFanioArena( int fArena )
+{
+    int fOld = s_fAbcFanioArena;
+    s_fAbcFanioArena = fArena;
+    return fOld;
+}
+int Abc_NtkReadFanioArena()
+{
+    return s_fAbcFanioArena;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Moves the fanin/fanout arrays of the network into one slab.]
+
+  Description [The arrays are placed in the order of object IDs, with
+  the fanins of each object followed by its fanouts, and their capacity 
+  is reduced to their size. The arrays that grow later are reallocated 
+  by the step memory manager, while their old place in the slab stays 
+  unused until the network is deleted. Works only for the networks 
+  with the memory manager for arrays.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Abc_NtkArenaMove( Abc_Ntk_t * pNtk, Vec_Int_t * p, int * pArray )
+{
+    memcpy( pArray, p->pArray, sizeof(int) * p->nSize );
+    if ( p->pArray && !Abc_NtkArenaHas(pNtk, p->pArray) )
+        Mem_StepEntryRecycle( pNtk->pMmStep, (char *)p->pArray, p->nCap * 4 );
+    p->pArray = p->nSize ? pArray : NULL;
+    p->nCap   = p->nSize;
+}
+void Abc_NtkCompactFanio( Abc_Ntk_t * pNtk )
+{
+    Abc_Obj_t * pObj;
+    int * pArena;
+    int i, nEntries = 0;
+    if ( pNtk->pMmStep == NULL )
+        return;
+    Abc_NtkForEachObj( pNtk, pObj, i )
+        nEntries += Vec_IntSize(&pObj->vFanins) + Vec_IntSize(&pObj->vFanouts);
+    pArena = ABC_ALLOC( int, Abc_MaxInt(nEntries, 1) );
+    nEntries = 0;
+    Abc_NtkForEachObj( pNtk, pObj, i )
+    {
+        Abc_NtkArenaMove( pNtk, &pObj->vFanins, pArena + nEntries );
+        nEntries += Vec_IntSize(&pObj->vFanins);
+        Abc_NtkArenaMove( pNtk, &pObj->vFanouts, pArena + nEntries );
+        nEntries += Vec_IntSize(&pObj->vFanouts);
+    }
+    ABC_FREE( pNtk->pArena );
+    pNtk->pArena = pArena;
+    pNtk->nArena = nEntries;
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
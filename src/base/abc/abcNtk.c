@@ -474,6 +474,9 @@ Abc_Ntk_t * Abc_NtkDup( Abc_Ntk_t * pNtk )
         Abc_NtkTransferPhases( pNtkNew, pNtk );
     if ( pNtk->pWLoadUsed )
         pNtkNew->pWLoadUsed = Abc_UtilStrsav( pNtk->pWLoadUsed );
+    // place the fanin/fanout arrays into one slab
+    if ( Abc_NtkReadFanioArena() )
+        Abc_NtkCompactFanio( pNtkNew );
     // check correctness
     if ( !Abc_NtkCheck( pNtkNew ) )
         fprintf( stdout, "Abc_NtkDup(): Network check has failed.\n" );
@@ -1352,6 +1355,7 @@ void Abc_NtkDelete( Abc_Ntk_t * pNtk )
         Mem_FixedStop( pNtk->pMmObj, 0 );
     if ( pNtk->pMmStep )
         Mem_StepStop ( pNtk->pMmStep, 0 );
+    ABC_FREE( pNtk->pArena );
     // name manager
     Nm_ManFree( pNtk->pManName );
     // free the timing manager
@@ -161,6 +161,7 @@ static int Abc_CommandAllExact               ( Abc_Frame_t * pAbc, int argc, cha
 static int Abc_CommandTestExact              ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandMajGen                 ( Abc_Frame_t * pAbc, int argc, char ** argv );
 
+static int Abc_CommandArena                  ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandLogic                  ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandComb                   ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandMiter                  ( Abc_Frame_t * pAbc, int argc, char ** argv );
@@ -385,6 +386,7 @@ static int Abc_CommandAbc9SaveAig            ( Abc_Frame_t * pAbc, int argc, cha
 static int Abc_CommandAbc9Load               ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9Load2              ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9LoadAig            ( Abc_Frame_t * pAbc, int argc, char ** argv );
+static int Abc_CommandAbc9Snap               ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9Read               ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9ReadBlif           ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9ReadCBlif          ( Abc_Frame_t * pAbc, int argc, char ** argv );
@@ -412,6 +414,8 @@ static int Abc_CommandAbc9Add1Hot            ( Abc_Frame_t * pAbc, int argc, cha
 static int Abc_CommandAbc9Cof                ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9Trim               ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9Dfs                ( Abc_Frame_t * pAbc, int argc, char ** argv );
+static int Abc_CommandAbc9Reorder            ( Abc_Frame_t * pAbc, int argc, char ** argv );
+static int Abc_CommandAbc9Fanout             ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9Sim                ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9Sim3               ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9MLGen              ( Abc_Frame_t * pAbc, int argc, char ** argv );
@@ -885,6 +889,7 @@ void Abc_Init( Abc_Frame_t * pAbc )
     Cmd_CommandAdd( pAbc, "Exact synthesis", "testexact",  Abc_CommandTestExact,        0 );
     Cmd_CommandAdd( pAbc, "Exact synthesis", "majgen",     Abc_CommandMajGen,           0 );
 
+    Cmd_CommandAdd( pAbc, "Various",      "arena",         Abc_CommandArena,            0 );
     Cmd_CommandAdd( pAbc, "Various",      "logic",         Abc_CommandLogic,            1 );
     Cmd_CommandAdd( pAbc, "Various",      "comb",          Abc_CommandComb,             1 );
     Cmd_CommandAdd( pAbc, "Various",      "miter",         Abc_CommandMiter,            1 );
@@ -1105,6 +1110,7 @@ void Abc_Init( Abc_Frame_t * pAbc )
     Cmd_CommandAdd( pAbc, "ABC9",         "&load",         Abc_CommandAbc9Load,         0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&load2",        Abc_CommandAbc9Load2,        0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&loadaig",      Abc_CommandAbc9LoadAig,      0 );
+    Cmd_CommandAdd( pAbc, "ABC9",         "&snap",         Abc_CommandAbc9Snap,         0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&r",            Abc_CommandAbc9Read,         0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&read",         Abc_CommandAbc9Read,         0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&read_blif",    Abc_CommandAbc9ReadBlif,     0 );
@@ -1134,6 +1140,8 @@ void Abc_Init( Abc_Frame_t * pAbc )
     Cmd_CommandAdd( pAbc, "ABC9",         "&cof",          Abc_CommandAbc9Cof,          0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&trim",         Abc_CommandAbc9Trim,         0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&dfs",          Abc_CommandAbc9Dfs,          0 );
+    Cmd_CommandAdd( pAbc, "ABC9",         "&reorder",      Abc_CommandAbc9Reorder,      0 );
+    Cmd_CommandAdd( pAbc, "ABC9",         "&fanout",       Abc_CommandAbc9Fanout,       0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&sim",          Abc_CommandAbc9Sim,          0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&sim3",         Abc_CommandAbc9Sim3,         0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&mlgen",        Abc_CommandAbc9MLGen,        0 );
@@ -1352,9 +1360,10 @@ void Abc_End( Abc_Frame_t * pAbc )
     Abc_NtkFraigStoreClean();
     Gia_ManStopP( &pAbc->pGia );
     Gia_ManStopP( &pAbc->pGia2 );
-    Gia_ManStopP( &pAbc->pGiaBest );
-    Gia_ManStopP( &pAbc->pGiaBest2 );
-    Gia_ManStopP( &pAbc->pGiaSaved );
+    Gia_SnapStopP( &pAbc->pGiaBest );
+    Gia_SnapStopP( &pAbc->pGiaBest2 );
+    Gia_SnapStopP( &pAbc->pGiaSaved );
+    Gia_SnapStopVec( &pAbc->vGiaSnaps );
     if ( Abc_NtkRecIsRunning3() )
         Abc_NtkRecStop3();
 }
@@ -9292,6 +9301,77 @@ usage:
     return 1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_CommandArena( Abc_Frame_t * pAbc, int argc, char ** argv )
+{
+    Abc_Ntk_t * pNtk = Abc_FrameReadNtk(pAbc);
+    int c, fArena = Abc_NtkReadFanioArena();
+    int fCompact = 0;
+    int fVerbose = 0;
+    Extra_UtilGetoptReset();
+    while ( ( c = Extra_UtilGetopt( argc, argv, "acvh" ) ) != EOF )
+    {
+        switch ( c )
+        {
+        case 'a':
+            fArena ^= 1;
+            break;
+        case 'c':
+            fCompact ^= 1;
+            break;
+        case 'v':
+            fVerbose ^= 1;
+            break;
+        case 'h':
+            goto usage;
+        default:
+            goto usage;
+        }
+    }
+    Abc_NtkSetFanioArena( fArena );
+    if ( fCompact )
+    {
+        if ( pNtk == NULL )
+        {
+            Abc_Print( -1, "Empty network.\n" );
+            return 1;
+        }
+        if ( pNtk->pMmStep == NULL )
+        {
+            Abc_Print( -1, "The current network does not use the memory manager for fanin/fanout arrays.\n" );
+            return 1;
+        }
+        Abc_NtkCompactFanio( pNtk );
+    }
+    if ( fVerbose )
+    {
+        Abc_Print( 1, "The networks duplicated from now on are %scompacted.\n", fArena ? "" : "not " );
+        if ( pNtk && pNtk->pArena )
+            Abc_Print( 1, "The fanin/fanout slab of the current network has %d entries (%.2f MB).\n", pNtk->nArena, 4.0 * pNtk->nArena / (1<<20) );
+    }
+    return 0;
+
+usage:
+    Abc_Print( -2, "usage: arena [-acvh]\n" );
+    Abc_Print( -2, "\t         places the fanin/fanout arrays of the network into one slab,\n" );
+    Abc_Print( -2, "\t         which improves the locality of the traversals\n" );
+    Abc_Print( -2, "\t-a     : toggle compacting the networks duplicated by later commands [default = %s]\n", fArena? "yes": "no" );
+    Abc_Print( -2, "\t-c     : toggle compacting the current network now [default = %s]\n", fCompact? "yes": "no" );
+    Abc_Print( -2, "\t-v     : toggle printing verbose information [default = %s]\n", fVerbose? "yes": "no" );
+    Abc_Print( -2, "\t-h     : print the command usage\n");
+    return 1;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -25697,12 +25777,12 @@ int Abc_CommandAbc9Satoko( Abc_Frame_t * pAbc, int argc, char ** argv )
 {
     extern void Gia_ManSatokoDimacs( char * pFileName, satoko_opts_t * opts );
     extern void Gia_ManSatokoCall( Gia_Man_t * p, satoko_opts_t * opts, int fSplit, int fIncrem );
-    int c, fSplit = 0, fIncrem = 0;
+    int c, fSplit = 0, fIncrem = 0, fSetI = 0;
 
     satoko_opts_t opts;
     satoko_default_opts(&opts);
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "Csivh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "CIsievh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -25717,12 +25797,27 @@ int Abc_CommandAbc9Satoko( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( opts.conf_limit < 0 )
                 goto usage;
             break;
+        case 'I':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-I\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            opts.n_conf_inprocess = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( (int)opts.n_conf_inprocess < 0 )
+                goto usage;
+            fSetI = 1;
+            break;
         case 's':
             fSplit ^= 1;
             break;
         case 'i':
             fIncrem ^= 1;
             break;
+        case 'e':
+            opts.bve_max_occs = opts.bve_max_occs ? 0 : 8;
+            break;
         case 'v':
             opts.verbose ^= 1;
             break;
@@ -25733,6 +25828,8 @@ int Abc_CommandAbc9Satoko( Abc_Frame_t * pAbc, int argc, char ** argv )
             goto usage;
         }
     }
+    if ( opts.bve_max_occs && !fSetI )
+        opts.n_conf_inprocess = 10000;
     if ( argc == globalUtilOptind + 1 )
     {
         Gia_ManSatokoDimacs( argv[globalUtilOptind], &opts );
@@ -25747,11 +25844,13 @@ int Abc_CommandAbc9Satoko( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &satoko [-C num] [-sivh] <file.cnf>\n" );
+    Abc_Print( -2, "usage: &satoko [-CI num] [-sievh] <file.cnf>\n" );
     Abc_Print( -2, "\t             run Satoko by Bruno Schmitt\n" );
     Abc_Print( -2, "\t-C num     : limit on the number of conflicts [default = %d]\n", opts.conf_limit );
+    Abc_Print( -2, "\t-I num     : conflicts between inprocessing rounds (0 = no inprocessing) [default = %d]\n", opts.n_conf_inprocess );
     Abc_Print( -2, "\t-s         : split multi-output miter into individual outputs [default = %s]\n", fSplit? "yes": "no" );
     Abc_Print( -2, "\t-i         : split multi-output miter and solve incrementally [default = %s]\n", fIncrem? "yes": "no" );
+    Abc_Print( -2, "\t-e         : toggle variable elimination during inprocessing (implies -I 10000 unless -I is given) [default = %s]\n", opts.bve_max_occs? "yes": "no" );
     Abc_Print( -2, "\t-v         : prints verbose information [default = %s]\n", opts.verbose? "yes": "no" );
     Abc_Print( -2, "\t<file.cnf> : (optional) CNF file to solve\n");
     Abc_Print( -2, "\t-h         : print the command usage\n");
@@ -29983,11 +30082,24 @@ int Abc_CommandAbc9Read( Abc_Frame_t * pAbc, int argc, char ** argv )
     int fVerbose = 0;
     int fGiaSimple = 0;
     int fSkipStrash = 0;
+    int nThreads = 1;
+    abctime clk = Abc_ClockWall();
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "csmnlvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "Pcsmnlvh" ) ) != EOF )
     {
         switch ( c )
         {
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nThreads = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nThreads <= 0 )
+                goto usage;
+            break;
         case 'c':
             fGiaSimple ^= 1;
             break;
@@ -30043,20 +30155,23 @@ int Abc_CommandAbc9Read( Abc_Frame_t * pAbc, int argc, char ** argv )
 //    else if ( Extra_FileIsType( FileName, ".v", NULL, NULL ) )
 //        Abc3_ReadShowHie( FileName, fSkipStrash );
     else
-        pAig = Gia_AigerRead( FileName, fGiaSimple, fSkipStrash, 0 );
+        pAig = Gia_AigerReadPar( FileName, fGiaSimple, fSkipStrash, 0, nThreads );
+    if ( pAig && fVerbose )
+        Abc_PrintTime( 1, "Reading time", Abc_ClockWall() - clk );
     if ( pAig )
         Abc_FrameUpdateGia( pAbc, pAig );
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &r [-csmnlvh] <file>\n" );
+    Abc_Print( -2, "usage: &r [-P num] [-csmnlvh] <file>\n" );
     Abc_Print( -2, "\t         reads the current AIG from the AIGER file\n" );
+    Abc_Print( -2, "\t-P num : the number of threads decoding the AND gates [default = %d]\n", nThreads );
     Abc_Print( -2, "\t-c     : toggles reading simple AIG [default = %s]\n", fGiaSimple? "yes": "no" );
     Abc_Print( -2, "\t-s     : toggles structural hashing while reading [default = %s]\n", !fSkipStrash? "yes": "no" );
     Abc_Print( -2, "\t-m     : toggles reading MiniAIG rather than AIGER file [default = %s]\n", fMiniAig? "yes": "no" );
     Abc_Print( -2, "\t-n     : toggles reading MiniAIG as a set of supergates [default = %s]\n", fMiniAig2? "yes": "no" );
     Abc_Print( -2, "\t-l     : toggles reading MiniLUT rather than AIGER file [default = %s]\n", fMiniLut? "yes": "no" );
-    Abc_Print( -2, "\t-v     : toggles additional verbose output [default = %s]\n", fVerbose? "yes": "no" );
+    Abc_Print( -2, "\t-v     : toggles additional verbose output (including the wall-clock reading time) [default = %s]\n", fVerbose? "yes": "no" );
     Abc_Print( -2, "\t-h     : print the command usage\n");
     Abc_Print( -2, "\t<file> : the file name\n");
     return 1;
@@ -30076,17 +30191,21 @@ usage:
 int Abc_CommandAbc9ReadBlif( Abc_Frame_t * pAbc, int argc, char ** argv )
 {
     extern Gia_Man_t * Abc_NtkHieCecTest( char * pFileName, int fVerbose );
+    extern Gia_Man_t * Io_ReadBlifAsGia( char * pFileName, int fVerbose );
     Gia_Man_t * pAig;
     FILE * pFile;
     char ** pArgvNew;
     char * FileName, * pTemp;
     int nArgcNew;
-    int c, fVerbose = 0;
+    int c, fStream = 0, fVerbose = 0;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "vh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "svh" ) ) != EOF )
     {
         switch ( c )
         {
+        case 's':
+            fStream ^= 1;
+            break;
         case 'v':
             fVerbose ^= 1;
             break;
@@ -30118,14 +30237,18 @@ int Abc_CommandAbc9ReadBlif( Abc_Frame_t * pAbc, int argc, char ** argv )
     }
     fclose( pFile );
 
-    pAig = Abc_NtkHieCecTest( FileName, fVerbose );
+    if ( fStream )
+        pAig = Io_ReadBlifAsGia( FileName, fVerbose );
+    else
+        pAig = Abc_NtkHieCecTest( FileName, fVerbose );
     Abc_FrameUpdateGia( pAbc, pAig );
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &read_blif [-vh] <file>\n" );
+    Abc_Print( -2, "usage: &read_blif [-svh] <file>\n" );
     Abc_Print( -2, "\t         a specialized reader for hierarchical BLIF files\n" );
     Abc_Print( -2, "\t         (for general-purpose BLIFs, please use \"read_blif\")\n" );
+    Abc_Print( -2, "\t-s     : toggles streaming a flat BLIF file directly into the AIG [default = %s]\n", fStream? "yes": "no" );
     Abc_Print( -2, "\t-v     : toggles additional verbose output [default = %s]\n", fVerbose? "yes": "no" );
     Abc_Print( -2, "\t-h     : print the command usage\n");
     Abc_Print( -2, "\t<file> : the file name\n");
@@ -30637,15 +30760,15 @@ usage:
   SeeAlso     []
 
 ***********************************************************************/
-static inline int Gia_ManCompareWithBest( Gia_Man_t * pBest, Gia_Man_t * p, int * pnBestLuts, int * pnBestEdges, int * pnBestLevels, int fArea )
+static inline int Gia_ManCompareWithBest( Gia_Snap_t * pBest, Gia_Man_t * p, int * pnBestLuts, int * pnBestEdges, int * pnBestLevels, int fArea )
 {
     int nCurLuts, nCurEdges, nCurLevels;
     Gia_ManLutParams( p, &nCurLuts, &nCurEdges, &nCurLevels );
     if ( pBest == NULL ||
-         Gia_ManPiNum(pBest) != Gia_ManPiNum(p) ||
-         Gia_ManPoNum(pBest) != Gia_ManPoNum(p) ||
-         Gia_ManRegNum(pBest) != Gia_ManRegNum(p) ||
-         strcmp(Gia_ManName(pBest), Gia_ManName(p)) ||
+         pBest->nPis != Gia_ManPiNum(p) ||
+         pBest->nPos != Gia_ManPoNum(p) ||
+         pBest->nRegs != Gia_ManRegNum(p) ||
+         strcmp(pBest->pName, Gia_ManName(p)) ||
          (!fArea && (*pnBestLevels > nCurLevels || (*pnBestLevels == nCurLevels && 2*(*pnBestLuts) + *pnBestEdges > 2*nCurLuts + nCurEdges))) ||
          ( fArea && (*pnBestLuts   > nCurLuts   || (*pnBestLuts   == nCurLuts   && *pnBestLevels > nCurLevels)))
        )
@@ -30700,8 +30823,8 @@ int Abc_CommandAbc9Save( Abc_Frame_t * pAbc, int argc, char ** argv )
     if ( !Gia_ManCompareWithBest( pAbc->pGiaBest, pAbc->pGia, &pAbc->nBestLuts, &pAbc->nBestEdges, &pAbc->nBestLevels, fArea ) )
         return 0;
     // save the design as best
-    Gia_ManStopP( &pAbc->pGiaBest );
-    pAbc->pGiaBest = Gia_ManDupWithAttributes( pAbc->pGia );
+    Gia_SnapStopP( &pAbc->pGiaBest );
+    pAbc->pGiaBest = Gia_SnapStart( pAbc->pGia );
     return 0;
 
 usage:
@@ -30753,8 +30876,8 @@ int Abc_CommandAbc9Save2( Abc_Frame_t * pAbc, int argc, char ** argv )
     if ( !Gia_ManCompareWithBest( pAbc->pGiaBest2, pAbc->pGia, &pAbc->nBestLuts2, &pAbc->nBestEdges2, &pAbc->nBestLevels2, fArea ) )
         return 0;
     // save the design as best
-    Gia_ManStopP( &pAbc->pGiaBest2 );
-    pAbc->pGiaBest2 = Gia_ManDupWithAttributes( pAbc->pGia );
+    Gia_SnapStopP( &pAbc->pGiaBest2 );
+    pAbc->pGiaBest2 = Gia_SnapStart( pAbc->pGia );
     return 0;
 
 usage:
@@ -30798,11 +30921,11 @@ int Abc_CommandAbc9SaveAig( Abc_Frame_t * pAbc, int argc, char ** argv )
         Abc_Print( -1, "Empty network.\n" );
         return 1;
     }
-    if ( fArea && pAbc->pGiaSaved != NULL && Gia_ManAndNum(pAbc->pGiaSaved) <= Gia_ManAndNum(pAbc->pGia) )
+    if ( fArea && pAbc->pGiaSaved != NULL && pAbc->pGiaSaved->nAnds <= Gia_ManAndNum(pAbc->pGia) )
         return 0;
     // save the design as best
-    Gia_ManStopP( &pAbc->pGiaSaved );
-    pAbc->pGiaSaved = Gia_ManDupWithAttributes( pAbc->pGia );
+    Gia_SnapStopP( &pAbc->pGiaSaved );
+    pAbc->pGiaSaved = Gia_SnapStart( pAbc->pGia );
     return 0;
 
 usage:
@@ -30845,7 +30968,7 @@ int Abc_CommandAbc9Load( Abc_Frame_t * pAbc, int argc, char ** argv )
         return 1;
     }
     Gia_ManStopP( &pAbc->pGia );
-    pAbc->pGia = Gia_ManDupWithAttributes( pAbc->pGiaBest );
+    pAbc->pGia = Gia_SnapRead( pAbc->pGiaBest );
     return 0;
 
 usage:
@@ -30888,8 +31011,8 @@ int Abc_CommandAbc9Load2( Abc_Frame_t * pAbc, int argc, char ** argv )
         return 1;
     }
     Gia_ManStopP( &pAbc->pGia );
-    pAbc->pGia = pAbc->pGiaBest2;
-    pAbc->pGiaBest2 = NULL;
+    pAbc->pGia = Gia_SnapRead( pAbc->pGiaBest2 );
+    Gia_SnapStopP( &pAbc->pGiaBest2 );
     pAbc->nBestLuts2 = 0;
     pAbc->nBestEdges2 = 0;
     pAbc->nBestLevels2 = 0;
@@ -30935,7 +31058,7 @@ int Abc_CommandAbc9LoadAig( Abc_Frame_t * pAbc, int argc, char ** argv )
         return 1;
     }
     Gia_ManStopP( &pAbc->pGia );
-    pAbc->pGia = Gia_ManDupWithAttributes( pAbc->pGiaSaved );
+    pAbc->pGia = Gia_SnapRead( pAbc->pGiaSaved );
     return 0;
 
 usage:
@@ -30945,6 +31068,117 @@ usage:
     return 1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_CommandAbc9Snap( Abc_Frame_t * pAbc, int argc, char ** argv )
+{
+    Gia_Snap_t * pSnap;
+    int c, i, iLoad = -1, iDelete = -1, fPrint = 0, fClear = 0;
+    double Memory = 0;
+    Extra_UtilGetoptReset();
+    while ( ( c = Extra_UtilGetopt( argc, argv, "LDpch" ) ) != EOF )
+    {
+        switch ( c )
+        {
+        case 'L':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-L\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            iLoad = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( iLoad < 0 )
+                goto usage;
+            break;
+        case 'D':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-D\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            iDelete = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( iDelete < 0 )
+                goto usage;
+            break;
+        case 'p':
+            fPrint ^= 1;
+            break;
+        case 'c':
+            fClear ^= 1;
+            break;
+        case 'h':
+            goto usage;
+        default:
+            goto usage;
+        }
+    }
+    if ( iLoad >= 0 )
+    {
+        if ( pAbc->vGiaSnaps == NULL || iLoad >= Vec_PtrSize(pAbc->vGiaSnaps) )
+        {
+            Abc_Print( -1, "Abc_CommandAbc9Snap(): There is no snapshot %d.\n", iLoad );
+            return 1;
+        }
+        Abc_FrameUpdateGia( pAbc, Gia_SnapRead( (Gia_Snap_t *)Vec_PtrEntry(pAbc->vGiaSnaps, iLoad) ) );
+    }
+    else if ( iDelete >= 0 )
+    {
+        if ( pAbc->vGiaSnaps == NULL || iDelete >= Vec_PtrSize(pAbc->vGiaSnaps) )
+        {
+            Abc_Print( -1, "Abc_CommandAbc9Snap(): There is no snapshot %d.\n", iDelete );
+            return 1;
+        }
+        Gia_SnapStop( (Gia_Snap_t *)Vec_PtrEntry(pAbc->vGiaSnaps, iDelete) );
+        Vec_PtrDrop( pAbc->vGiaSnaps, iDelete );
+    }
+    else if ( fClear )
+        Gia_SnapStopVec( &pAbc->vGiaSnaps );
+    else if ( !fPrint )
+    {
+        if ( pAbc->pGia == NULL )
+        {
+            Abc_Print( -1, "Abc_CommandAbc9Snap(): There is no AIG.\n" );
+            return 1;
+        }
+        if ( pAbc->vGiaSnaps == NULL )
+            pAbc->vGiaSnaps = Vec_PtrAlloc( 16 );
+        Vec_PtrPush( pAbc->vGiaSnaps, Gia_SnapStart(pAbc->pGia) );
+    }
+    if ( fPrint && pAbc->vGiaSnaps )
+    {
+        Vec_PtrForEachEntry( Gia_Snap_t *, pAbc->vGiaSnaps, pSnap, i )
+        {
+            printf( "%3d : ", i );
+            Gia_SnapPrint( pSnap );
+            Memory += Gia_SnapMemory( pSnap );
+        }
+        printf( "Total memory = %.2f MB\n", Memory / (1 << 20) );
+    }
+    return 0;
+
+usage:
+    Abc_Print( -2, "usage: &snap [-LD num] [-pch]\n" );
+    Abc_Print( -2, "\t        saves the current AIG as a compressed snapshot\n" );
+    Abc_Print( -2, "\t        (the snapshot is decompressed only when it is loaded)\n" );
+    Abc_Print( -2, "\t-L num : loads the snapshot with the given number instead [default = none]\n" );
+    Abc_Print( -2, "\t-D num : deletes the snapshot with the given number instead [default = none]\n" );
+    Abc_Print( -2, "\t-p     : toggle printing the list of snapshots instead [default = %s]\n", fPrint? "yes": "no" );
+    Abc_Print( -2, "\t-c     : toggle deleting all snapshots instead [default = %s]\n", fClear? "yes": "no" );
+    Abc_Print( -2, "\t-h     : print the command usage\n");
+    return 1;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -31048,11 +31282,23 @@ int Abc_CommandAbc9Write( Abc_Frame_t * pAbc, int argc, char ** argv )
     int fMiniLut = 0;
     int fWriteNewLine = 0;
     int fVerbose = 0;
+    int nThreads = 1;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "upmlnvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "Pupmlnvh" ) ) != EOF )
     {
         switch ( c )
         {
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nThreads = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nThreads <= 0 )
+                goto usage;
+            break;
         case 'u':
             fUnique ^= 1;
             break;
@@ -31103,12 +31349,13 @@ int Abc_CommandAbc9Write( Abc_Frame_t * pAbc, int argc, char ** argv )
     else if ( fMiniLut )
         Gia_ManWriteMiniLut( pAbc->pGia, pFileName );
     else
-        Gia_AigerWrite( pAbc->pGia, pFileName, 0, 0, fWriteNewLine );
+        Gia_AigerWritePar( pAbc->pGia, pFileName, 0, 0, fWriteNewLine, nThreads );
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &w [-upmlnvh] <file>\n" );
+    Abc_Print( -2, "usage: &w [-P num] [-upmlnvh] <file>\n" );
     Abc_Print( -2, "\t         writes the current AIG into the AIGER file\n" );
+    Abc_Print( -2, "\t-P num : the number of threads encoding the AND gates [default = %d]\n", nThreads );
     Abc_Print( -2, "\t-u     : toggle writing canonical AIG structure [default = %s]\n", fUnique? "yes" : "no" );
     Abc_Print( -2, "\t-p     : toggle writing Verilog with 'and' and 'not' [default = %s]\n", fVerilog? "yes" : "no" );
     Abc_Print( -2, "\t-m     : toggle writing MiniAIG rather than AIGER [default = %s]\n", fMiniAig? "yes" : "no" );
@@ -31196,6 +31443,7 @@ usage:
 int Abc_CommandAbc9Ps( Abc_Frame_t * pAbc, int argc, char ** argv )
 {
     Gps_Par_t Pars, * pPars = &Pars;
+    Gia_Man_t * pTemp;
     int c, fBest = 0;
     memset( pPars, 0, sizeof(Gps_Par_t) );
     Extra_UtilGetoptReset();
@@ -31258,7 +31506,9 @@ int Abc_CommandAbc9Ps( Abc_Frame_t * pAbc, int argc, char ** argv )
             Abc_Print( -1, "Abc_CommandAbc9Ps(): There is no AIG.\n" );
             return 1;
         }
-        Gia_ManPrintStats( pAbc->pGiaBest, pPars );
+        pTemp = Gia_SnapRead( pAbc->pGiaBest );
+        Gia_ManPrintStats( pTemp, pPars );
+        Gia_ManStop( pTemp );
     }
     else
     {
@@ -32492,6 +32742,160 @@ usage:
     return 1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_CommandAbc9Reorder( Abc_Frame_t * pAbc, int argc, char ** argv )
+{
+    Gia_Man_t * pTemp;
+    int c;
+    int Type     = 2;
+    int nWords   = 64;
+    int fBench   = 0;
+    int fVerbose = 0;
+    Extra_UtilGetoptReset();
+    while ( ( c = Extra_UtilGetopt( argc, argv, "TWbvh" ) ) != EOF )
+    {
+        switch ( c )
+        {
+        case 'T':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-T\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            Type = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( Type < 0 || Type > 2 )
+                goto usage;
+            break;
+        case 'W':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-W\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nWords = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nWords <= 0 )
+                goto usage;
+            break;
+        case 'b':
+            fBench ^= 1;
+            break;
+        case 'v':
+            fVerbose ^= 1;
+            break;
+        case 'h':
+            goto usage;
+        default:
+            goto usage;
+        }
+    }
+    if ( pAbc->pGia == NULL )
+    {
+        Abc_Print( -1, "Abc_CommandAbc9Reorder(): There is no AIG.\n" );
+        return 1;
+    }
+    if ( Gia_ManHasChoices(pAbc->pGia) )
+    {
+        Abc_Print( -1, "Abc_CommandAbc9Reorder(): Reordering AIGs with choices is not supported.\n" );
+        return 1;
+    }
+    if ( fBench )
+    {
+        Abc_Print( 1, "Before reordering:\n" );
+        Gia_ManReorderBench( pAbc->pGia, nWords );
+    }
+    pTemp = Gia_ManReorder( pAbc->pGia, Type, fVerbose );
+    if ( pTemp == NULL )
+        return 1;
+    if ( fBench )
+    {
+        Abc_Print( 1, "After reordering:\n" );
+        Gia_ManReorderBench( pTemp, nWords );
+    }
+    Abc_FrameUpdateGia( pAbc, pTemp );
+    return 0;
+
+usage:
+    Abc_Print( -2, "usage: &reorder [-TW num] [-bvh]\n" );
+    Abc_Print( -2, "\t        renumbers AIG objects to improve memory locality\n" );
+    Abc_Print( -2, "\t-T num : the order (0 = DFS; 1 = levels; 2 = DFS by deeper fanin) [default = %d]\n", Type );
+    Abc_Print( -2, "\t-W num : the number of simulation words for the benchmark [default = %d]\n", nWords );
+    Abc_Print( -2, "\t-b     : toggle benchmarking simulation and cuts before and after [default = %s]\n", fBench? "yes": "no" );
+    Abc_Print( -2, "\t-v     : toggle printing verbose information [default = %s]\n", fVerbose? "yes": "no" );
+    Abc_Print( -2, "\t-h     : print the command usage\n");
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_CommandAbc9Fanout( Abc_Frame_t * pAbc, int argc, char ** argv )
+{
+    int c;
+    int nEdits   = 1000;
+    int fVerbose = 0;
+    Extra_UtilGetoptReset();
+    while ( ( c = Extra_UtilGetopt( argc, argv, "Nvh" ) ) != EOF )
+    {
+        switch ( c )
+        {
+        case 'N':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-N\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nEdits = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nEdits < 0 )
+                goto usage;
+            break;
+        case 'v':
+            fVerbose ^= 1;
+            break;
+        case 'h':
+            goto usage;
+        default:
+            goto usage;
+        }
+    }
+    if ( pAbc->pGia == NULL )
+    {
+        Abc_Print( -1, "Abc_CommandAbc9Fanout(): There is no AIG.\n" );
+        return 1;
+    }
+    Gia_ManDynFanoutTest( pAbc->pGia, nEdits, fVerbose );
+    return 0;
+
+usage:
+    Abc_Print( -2, "usage: &fanout [-N num] [-vh]\n" );
+    Abc_Print( -2, "\t        compares incremental fanout updates with static rebuilds\n" );
+    Abc_Print( -2, "\t        (the changes are made in a copy of the current AIG)\n" );
+    Abc_Print( -2, "\t-N num : the number of random changes [default = %d]\n", nEdits );
+    Abc_Print( -2, "\t-v     : toggle printing verbose information [default = %s]\n", fVerbose? "yes": "no" );
+    Abc_Print( -2, "\t-h     : print the command usage\n");
+    return 1;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -32507,10 +32911,10 @@ int Abc_CommandAbc9Sim( Abc_Frame_t * pAbc, int argc, char ** argv )
 {
     Gia_ParSim_t Pars, * pPars = &Pars;
     char * pFileName = NULL;
-    int c;
+    int c, fKernel = 0, fPatSim = 0, nThreads = 1;
     Gia_ManSimSetDefaultParams( pPars );
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "FWNTImvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "FWNTPImkpvh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -32558,6 +32962,17 @@ int Abc_CommandAbc9Sim( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( pPars->TimeLimit < 0 )
                 goto usage;
             break;
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nThreads = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nThreads < 1 || nThreads > GIA_SIM_THR_MAX )
+                goto usage;
+            break;
         case 'I':
             if ( globalUtilOptind >= argc )
             {
@@ -32572,6 +32987,12 @@ int Abc_CommandAbc9Sim( Abc_Frame_t * pAbc, int argc, char ** argv )
         case 'm':
             pPars->fCheckMiter ^= 1;
             break;
+        case 'k':
+            fKernel ^= 1;
+            break;
+        case 'p':
+            fPatSim ^= 1;
+            break;
         case 'v':
             pPars->fVerbose ^= 1;
             break;
@@ -32586,6 +33007,12 @@ int Abc_CommandAbc9Sim( Abc_Frame_t * pAbc, int argc, char ** argv )
         Abc_Print( -1, "Abc_CommandAbc9Sim(): There is no AIG.\n" );
         return 1;
     }
+    pPars->nThreads = nThreads;
+    if ( fPatSim )
+    {
+        Gia_ManSimPatBench( pAbc->pGia, pPars->nWords, fKernel, nThreads );
+        return 0;
+    }
     if ( Gia_ManRegNum(pAbc->pGia) == 0 )
     {
         Abc_Print( -1, "The network is combinational.\n" );
@@ -32614,14 +33041,17 @@ int Abc_CommandAbc9Sim( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &sim [-FWNT num] [-mvh] -I <file>\n" );
+    Abc_Print( -2, "usage: &sim [-FWNTP num] [-mkpvh] -I <file>\n" );
     Abc_Print( -2, "\t         performs random simulation of the sequential miter\n" );
     Abc_Print( -2, "\t         (if candidate equivalences are defined, performs refinement)\n" );
     Abc_Print( -2, "\t-F num : the number of frames to simulate [default = %d]\n", pPars->nIters );
     Abc_Print( -2, "\t-W num : the number of words to simulate [default = %d]\n", pPars->nWords );
     Abc_Print( -2, "\t-N num : random number seed (1 <= num <= 1000) [default = %d]\n", pPars->RandSeed );
-    Abc_Print( -2, "\t-T num : approximate runtime limit in seconds [default = %d]\n", pPars->TimeLimit );
+    Abc_Print( -2, "\t-T num : approximate runtime limit in seconds of wall-clock time [default = %d]\n", pPars->TimeLimit );
+    Abc_Print( -2, "\t-P num : the number of threads, each simulating a range of words (1 <= num <= %d) [default = %d]\n", GIA_SIM_THR_MAX, nThreads );
     Abc_Print( -2, "\t-m     : toggle miter vs. any circuit [default = %s]\n", pPars->fCheckMiter? "miter": "circuit" );
+    Abc_Print( -2, "\t-k     : toggle using SIMD kernel in pattern simulation [default = %s]\n", fKernel? "yes": "no" );
+    Abc_Print( -2, "\t-p     : toggle one combinational pattern simulation of W words with throughput [default = %s]\n", fPatSim? "yes": "no" );
     Abc_Print( -2, "\t-v     : toggle printing verbose information [default = %s]\n", pPars->fVerbose? "yes": "no" );
     Abc_Print( -2, "\t-h     : print the command usage\n");
     Abc_Print( -2, "\t-I file: (optional) file with input patterns (one line per frame, as many as PIs)\n");
@@ -35906,7 +36336,7 @@ int Abc_CommandAbc9Scorr( Abc_Frame_t * pAbc, int argc, char ** argv )
     int c;
     Cec_ManCorSetDefaultParams( pPars );
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "FCPpkrecqwvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "FCPWTpkrecqwvh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -35943,6 +36373,28 @@ int Abc_CommandAbc9Scorr( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( pPars->nPrefix < 0 )
                 goto usage;
             break;
+        case 'W':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-W\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->nWords = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nWords <= 0 )
+                goto usage;
+            break;
+        case 'T':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-T\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->nProcs = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nProcs <= 0 )
+                goto usage;
+            break;
         case 'p':
             fPartition ^= 1;
             break;
@@ -36000,11 +36452,13 @@ int Abc_CommandAbc9Scorr( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &scorr [-FCP num] [-pkrecqwvh]\n" );
+    Abc_Print( -2, "usage: &scorr [-FCPWT num] [-pkrecqwvh]\n" );
     Abc_Print( -2, "\t         performs signal correpondence computation\n" );
     Abc_Print( -2, "\t-C num : the max number of conflicts at a node [default = %d]\n", pPars->nBTLimit );
     Abc_Print( -2, "\t-F num : the number of timeframes in inductive case [default = %d]\n", pPars->nFrames );
     Abc_Print( -2, "\t-P num : the number of timeframes in the prefix [default = %d]\n", pPars->nPrefix );
+    Abc_Print( -2, "\t-W num : the number of simulation words [default = %d]\n", pPars->nWords );
+    Abc_Print( -2, "\t-T num : the number of threads, each simulating a range of words [default = %d]\n", pPars->nProcs );
     Abc_Print( -2, "\t-p     : toggle using partitioning for the input AIG [default = %s]\n", fPartition? "yes": "no" );
     Abc_Print( -2, "\t-k     : toggle using constant correspondence [default = %s]\n", pPars->fConstCorr? "yes": "no" );
     Abc_Print( -2, "\t-r     : toggle using implication rings during refinement [default = %s]\n", pPars->fUseRings? "yes": "no" );
@@ -36093,13 +36547,15 @@ usage:
 int Abc_CommandAbc9Sat( Abc_Frame_t * pAbc, int argc, char ** argv )
 {
     extern Vec_Int_t * Cbs2_ManSolveMiterNc( Gia_Man_t * pAig, int nConfs, Vec_Str_t ** pvStatus, int fVerbose );
+    extern int Cec_GiaPortfolioTest( Gia_Man_t * p, int nProcs, int nTimeOut, int fShare, int nShareSize, int nShareLbd, int fVerbose, int fSilent );
     Cec_ParSat_t ParsSat, * pPars = &ParsSat;
     Gia_Man_t * pTemp;
     int c;
     int fNewSolver = 0, fCSat = 0;
+    int fPortfolio = 0, nProcs = 4, nTimeOut = 0, fShare = 1;
     Cec_ManSatSetDefaultParams( pPars );
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "CSNanmtcxvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "CSNPTanmtcxpsvh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -36136,6 +36592,28 @@ int Abc_CommandAbc9Sat( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( pPars->nCallsRecycle < 0 )
                 goto usage;
             break;
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nProcs = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nProcs <= 0 || nProcs > 100 )
+                goto usage;
+            break;
+        case 'T':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-T\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nTimeOut = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nTimeOut < 0 )
+                goto usage;
+            break;
         case 'a':
             pPars->fSaveCexes ^= 1;
             break;
@@ -36154,6 +36632,12 @@ int Abc_CommandAbc9Sat( Abc_Frame_t * pAbc, int argc, char ** argv )
         case 'x':
             fNewSolver ^= 1;
             break;
+        case 'p':
+            fPortfolio ^= 1;
+            break;
+        case 's':
+            fShare ^= 1;
+            break;
         case 'v':
             pPars->fVerbose ^= 1;
             break;
@@ -36166,6 +36650,17 @@ int Abc_CommandAbc9Sat( Abc_Frame_t * pAbc, int argc, char ** argv )
         Abc_Print( -1, "Abc_CommandAbc9Sat(): There is no AIG.\n" );
         return 1;
     }
+    if ( fPortfolio )
+    {
+        if ( Gia_ManRegNum(pAbc->pGia) > 0 )
+        {
+            Abc_Print( -1, "Abc_CommandAbc9Sat(): The portfolio mode works only for combinational miters.\n" );
+            return 1;
+        }
+        pAbc->Status = Cec_GiaPortfolioTest( pAbc->pGia, nProcs, nTimeOut, fShare, 8, 4, pPars->fVerbose, 0 );
+        Abc_FrameReplaceCex( pAbc, &pAbc->pGia->pCexComb );
+        return 0;
+    }
     if ( fCSat )
     {
         Vec_Int_t * vCounters;
@@ -36195,17 +36690,21 @@ int Abc_CommandAbc9Sat( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &sat [-CSN <num>] [-anmctxvh]\n" );
+    Abc_Print( -2, "usage: &sat [-CSNPT <num>] [-anmctxpsvh]\n" );
     Abc_Print( -2, "\t         performs SAT solving for the combinational outputs\n" );
     Abc_Print( -2, "\t-C num : the max number of conflicts at a node [default = %d]\n", pPars->nBTLimit );
     Abc_Print( -2, "\t-S num : the min number of variables to recycle the solver [default = %d]\n", pPars->nSatVarMax );
     Abc_Print( -2, "\t-N num : the min number of calls to recycle the solver [default = %d]\n", pPars->nCallsRecycle );
+    Abc_Print( -2, "\t-P num : the number of solvers in the portfolio mode [default = %d]\n", nProcs );
+    Abc_Print( -2, "\t-T num : runtime limit in seconds per solver in the portfolio mode [default = %d]\n", nTimeOut );
     Abc_Print( -2, "\t-a     : toggle solving all outputs and saving counter-examples [default = %s]\n", pPars->fSaveCexes? "yes": "no" );
     Abc_Print( -2, "\t-n     : toggle using non-chronological backtracking [default = %s]\n", pPars->fNonChrono? "yes": "no" );
     Abc_Print( -2, "\t-m     : toggle miter vs. any circuit [default = %s]\n", pPars->fCheckMiter? "miter": "circuit" );
     Abc_Print( -2, "\t-c     : toggle using circuit-based SAT solver [default = %s]\n", fCSat? "yes": "no" );
     Abc_Print( -2, "\t-t     : toggle using learning in curcuit-based solver [default = %s]\n", pPars->fLearnCls? "yes": "no" );
     Abc_Print( -2, "\t-x     : toggle using new solver [default = %s]\n", fNewSolver? "yes": "no" );
+    Abc_Print( -2, "\t-p     : toggle using a portfolio of solvers in parallel [default = %s]\n", fPortfolio? "yes": "no" );
+    Abc_Print( -2, "\t-s     : toggle sharing learned clauses in the portfolio mode [default = %s]\n", fShare? "yes": "no" );
     Abc_Print( -2, "\t-v     : toggle printing verbose information [default = %s]\n", pPars->fVerbose? "yes": "no" );
     Abc_Print( -2, "\t-h     : print the command usage\n");
     return 1;
@@ -36299,7 +36798,7 @@ int Abc_CommandAbc9Fraig( Abc_Frame_t * pAbc, int argc, char ** argv )
     int c, fUseAlgo = 0, fUseAlgoG = 0, fUseAlgoG2 = 0;
     Cec4_ManSetParams( pPars );
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "JWRILDCNPrmdckngxwvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "JWRILDCNPTrmdckngxwvh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -36402,6 +36901,17 @@ int Abc_CommandAbc9Fraig( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( pPars->nGenIters < 0 )
                 goto usage;
             break;
+        case 'T':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-T\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->nProcs = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nProcs <= 0 )
+                goto usage;
+            break;
         case 'r':
             pPars->fRewriting ^= 1;
             break;
@@ -36453,7 +36963,7 @@ int Abc_CommandAbc9Fraig( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &fraig [-JWRILDCNP <num>] [-rmdckngwvh]\n" );
+    Abc_Print( -2, "usage: &fraig [-JWRILDCNPT <num>] [-rmdckngxwvh]\n" );
     Abc_Print( -2, "\t         performs combinational SAT sweeping\n" );
     Abc_Print( -2, "\t-J num : the solver type [default = %d]\n", pPars->jType );
     Abc_Print( -2, "\t-W num : the number of simulation words [default = %d]\n", pPars->nWords );
@@ -36464,6 +36974,7 @@ usage:
     Abc_Print( -2, "\t-C num : the max number of conflicts at a node [default = %d]\n", pPars->nBTLimit );
     Abc_Print( -2, "\t-N num : the min number of calls to recycle the solver [default = %d]\n", pPars->nCallsRecycle );
     Abc_Print( -2, "\t-P num : the number of pattern generation iterations [default = %d]\n", pPars->nGenIters );
+    Abc_Print( -2, "\t-T num : the number of threads simulating ranges of words and solving the pairs of -x [default = %d]\n", pPars->nProcs );
     Abc_Print( -2, "\t-r     : toggle the use of AIG rewriting [default = %s]\n", pPars->fRewriting? "yes": "no" );
     Abc_Print( -2, "\t-m     : toggle miter vs. any circuit [default = %s]\n", pPars->fCheckMiter? "miter": "circuit" );
     Abc_Print( -2, "\t-d     : toggle using double output miters [default = %s]\n", pPars->fDualOut? "yes": "no" );
@@ -36471,6 +36982,7 @@ usage:
     Abc_Print( -2, "\t-k     : toggle using logic cones in the SAT solver [default = %s]\n", pPars->fUseCones? "yes": "no" );
     Abc_Print( -2, "\t-n     : toggle using new implementation [default = %s]\n", fUseAlgo? "yes": "no" );
     Abc_Print( -2, "\t-g     : toggle using another new implementation [default = %s]\n", fUseAlgoG? "yes": "no" );
+    Abc_Print( -2, "\t-x     : toggle using the third new implementation [default = %s]\n", fUseAlgoG2? "yes": "no" );
     Abc_Print( -2, "\t-w     : toggle printing even more verbose information [default = %s]\n", pPars->fVeryVerbose? "yes": "no" );
     Abc_Print( -2, "\t-v     : toggle printing verbose information [default = %s]\n", pPars->fVerbose? "yes": "no" );
     Abc_Print( -2, "\t-h     : print the command usage\n");
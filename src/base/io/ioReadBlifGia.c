@@ -0,0 +1,682 @@
+/**CFile****************************************************************
+
+  FileName    [ioReadBlifGia.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Command processing package.]
+
+  Synopsis    [Streaming reader of flat BLIF files into GIA.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: ioReadBlifGia.c,v 1.00 2026/10/17 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "base/abc/abc.h"
+#include "aig/gia/gia.h"
+#include "misc/util/utilNam.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define IO_BLIF_GIA_CHUNK  (1 << 20)   // the size of the file reading buffer
+
+typedef struct Io_BlifGia_t_ Io_BlifGia_t;  // streaming parser
+struct Io_BlifGia_t_
+{
+    // file reading
+    char *               pFileName;    // the name of the file
+    FILE *               pFile;        // the file being read
+    char *               pChunk;       // the current chunk of the file
+    int                  nChunk;       // the number of bytes in the chunk
+    int                  iChunk;       // the next byte to read in the chunk
+    int                  nLines;       // the number of lines read
+    int                  fUnread;      // the current line should be returned again
+    Vec_Str_t *          vLine;        // the current line (with extensions unfolded)
+    Vec_Ptr_t *          vTokens;      // the tokens of the current line
+    // name mapping
+    Abc_Nam_t *          pNames;       // the signal names
+    Vec_Int_t *          vName2Lit;    // the AIG literal of each name (-1 if not built yet)
+    Vec_Int_t *          vName2Pend;   // the pending table of each name (-1 if none)
+    Vec_Int_t *          vPis;         // the PI names
+    Vec_Int_t *          vPos;         // the PO names
+    Vec_Int_t *          vLis;         // the latch input names
+    Vec_Int_t *          vLos;         // the latch output names
+    Vec_Int_t *          vInits;       // the latch initial states
+    // tables whose fanins were not available when they were read
+    Vec_Int_t *          vPend;        // the output name, the SOP offset, the fanin count, and the fanin names
+    Vec_Str_t *          vPendSop;     // the SOPs of the pending tables
+    // current processing info
+    Gia_Man_t *          pGia;         // the AIG under construction
+    char *               pModel;       // the model name
+    Vec_Int_t *          vFanins;      // the fanin names of the current table
+    Vec_Int_t *          vLits;        // the fanin literals of the current table
+    Vec_Str_t *          vSop;         // the SOP of the current table
+    Vec_Int_t *          vStack;       // the DFS stack for resolving pending tables
+    Vec_Int_t *          vMarks;       // the names on the DFS path
+    char                 sError[512];  // the error string generated during parsing
+    // statistics
+    int                  nTables;      // the number of tables
+    int                  nTablesPend;  // the number of tables whose fanins came later
+    int                  nInitDc;      // the number of latches with don't-care initial state
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Allocates and frees the parser.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Io_BlifGia_t * Io_BlifGiaAlloc( char * pFileName, FILE * pFile )
+{
+    Io_BlifGia_t * p;
+    p = ABC_CALLOC( Io_BlifGia_t, 1 );
+    p->pFileName  = pFileName;
+    p->pFile      = pFile;
+    p->pChunk     = ABC_ALLOC( char, IO_BLIF_GIA_CHUNK );
+    p->vLine      = Vec_StrAlloc( 1000 );
+    p->vTokens    = Vec_PtrAlloc( 100 );
+    p->pNames     = Abc_NamStart( 1000, 20 );
+    p->vName2Lit  = Vec_IntStartFull( 1000 );
+    p->vName2Pend = Vec_IntStartFull( 1000 );
+    p->vPis       = Vec_IntAlloc( 100 );
+    p->vPos       = Vec_IntAlloc( 100 );
+    p->vLis       = Vec_IntAlloc( 100 );
+    p->vLos       = Vec_IntAlloc( 100 );
+    p->vInits     = Vec_IntAlloc( 100 );
+    p->vPend      = Vec_IntAlloc( 100 );
+    p->vPendSop   = Vec_StrAlloc( 100 );
+    p->vFanins    = Vec_IntAlloc( 100 );
+    p->vLits      = Vec_IntAlloc( 100 );
+    p->vSop       = Vec_StrAlloc( 1000 );
+    p->vStack     = Vec_IntAlloc( 100 );
+    p->vMarks     = Vec_IntAlloc( 1000 );
+    p->pGia       = Gia_ManStart( 10000 );
+    Gia_ManHashAlloc( p->pGia );
+    return p;
+}
+static void Io_BlifGiaFree( Io_BlifGia_t * p )
+{
+    if ( p->pGia )
+        Gia_ManStop( p->pGia );
+    Abc_NamStop( p->pNames );
+    Vec_StrFree( p->vLine );
+    Vec_PtrFree( p->vTokens );
+    Vec_IntFree( p->vName2Lit );
+    Vec_IntFree( p->vName2Pend );
+    Vec_IntFree( p->vPis );
+    Vec_IntFree( p->vPos );
+    Vec_IntFree( p->vLis );
+    Vec_IntFree( p->vLos );
+    Vec_IntFree( p->vInits );
+    Vec_IntFree( p->vPend );
+    Vec_StrFree( p->vPendSop );
+    Vec_IntFree( p->vFanins );
+    Vec_IntFree( p->vLits );
+    Vec_StrFree( p->vSop );
+    Vec_IntFree( p->vStack );
+    Vec_IntFree( p->vMarks );
+    ABC_FREE( p->pModel );
+    ABC_FREE( p->pChunk );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads one logic line of the file.]
+
+  Description [Removes comments, unfolds line extensions, and splits
+  the line into tokens. Only the current line is kept in memory.
+  Returns 0 when the end of the file is reached.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Io_BlifGiaReadChar( Io_BlifGia_t * p )
+{
+    if ( p->iChunk == p->nChunk )
+    {
+        p->nChunk = fread( p->pChunk, 1, IO_BLIF_GIA_CHUNK, p->pFile );
+        p->iChunk = 0;
+        if ( p->nChunk == 0 )
+            return EOF;
+    }
+    return (unsigned char)p->pChunk[p->iChunk++];
+}
+static int Io_BlifGiaReadLine( Io_BlifGia_t * p )
+{
+    char * pCur, * pLim;
+    int c, fComment;
+    if ( p->fUnread )
+    {
+        p->fUnread = 0;
+        return 1;
+    }
+    while ( 1 )
+    {
+        Vec_StrClear( p->vLine );
+        fComment = 0;
+        while ( (c = Io_BlifGiaReadChar(p)) != EOF )
+        {
+            if ( c == '\n' )
+            {
+                int i = Vec_StrSize(p->vLine);
+                p->nLines++;
+                // skip trailing spaces and check for the line extender
+                while ( i > 0 && (Vec_StrEntry(p->vLine, i-1) == ' ' || Vec_StrEntry(p->vLine, i-1) == '\t' || Vec_StrEntry(p->vLine, i-1) == '\r') )
+                    i--;
+                if ( i == 0 || Vec_StrEntry(p->vLine, i-1) != '\\' )
+                    break;
+                Vec_StrShrink( p->vLine, i-1 );
+                Vec_StrPush( p->vLine, ' ' );
+                fComment = 0;
+                continue;
+            }
+            if ( c == '#' )
+                fComment = 1;
+            if ( !fComment )
+                Vec_StrPush( p->vLine, (char)c );
+        }
+        if ( c == EOF && Vec_StrSize(p->vLine) == 0 )
+            return 0;
+        Vec_StrPush( p->vLine, '\0' );
+        // split the line into tokens
+        Vec_PtrClear( p->vTokens );
+        pLim = Vec_StrArray(p->vLine) + Vec_StrSize(p->vLine) - 1;
+        for ( pCur = Vec_StrArray(p->vLine); pCur < pLim; pCur++ )
+            if ( *pCur == ' ' || *pCur == '\t' || *pCur == '\r' )
+                *pCur = 0;
+        for ( pCur = Vec_StrArray(p->vLine); pCur < pLim; pCur++ )
+        {
+            if ( *pCur == 0 )
+                continue;
+            Vec_PtrPush( p->vTokens, pCur );
+            while ( *++pCur );
+        }
+        if ( Vec_PtrSize(p->vTokens) > 0 )
+            return 1;
+    }
+    return 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the name ID for the given token.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Io_BlifGiaNameId( Io_BlifGia_t * p, char * pToken )
+{
+    int NameId = Abc_NamStrFindOrAdd( p->pNames, pToken, NULL );
+    if ( NameId >= Vec_IntSize(p->vName2Lit) )
+    {
+        Vec_IntFillExtra( p->vName2Lit,  2 * NameId + 1, -1 );
+        Vec_IntFillExtra( p->vName2Pend, 2 * NameId + 1, -1 );
+    }
+    return NameId;
+}
+static inline int Io_BlifGiaNameLit( Io_BlifGia_t * p, int NameId )
+{
+    return Vec_IntEntry( p->vName2Lit, NameId );
+}
+static inline int Io_BlifGiaNameIsDefined( Io_BlifGia_t * p, int NameId )
+{
+    return Vec_IntEntry(p->vName2Lit, NameId) >= 0 || Vec_IntEntry(p->vName2Pend, NameId) >= 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Builds the AIG for the SOP.]
+
+  Description [Uses the factored form of the SOP if it is not trivial.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Io_BlifGiaBuildSop( Io_BlifGia_t * p, char * pSop, Vec_Int_t * vLits )
+{
+    extern int Gia_ManFactorNode( Gia_Man_t * p, char * pSop, Vec_Int_t * vLeaves );
+    int nVars = Vec_IntSize(vLits);
+    char * pCube;
+    int k;
+    // the empty table is constant 0
+    if ( *pSop == 0 )
+        return 0;
+    // the cube without literals makes the table constant
+    for ( pCube = pSop; *pCube; pCube += nVars + 3 )
+    {
+        for ( k = 0; k < nVars; k++ )
+            if ( pCube[k] != '-' )
+                break;
+        if ( k == nVars )
+            return Abc_LitNotCond( 1, pCube[nVars+1] == '0' );
+    }
+    return Gia_ManFactorNode( p->pGia, pSop, vLits );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Parses one table and builds it if its fanins are known.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Io_BlifGiaParseNames( Io_BlifGia_t * p )
+{
+    char * pProduct, * pOutput;
+    int i, NameId, NameFanin, nFanins, Polarity = -1, fReady = 1;
+    p->nTables++;
+    // collect the fanin and output names
+    nFanins = Vec_PtrSize(p->vTokens) - 2;
+    if ( nFanins < 0 )
+    {
+        snprintf( p->sError, sizeof(p->sError), "Line %d: Table does not have the output name.", p->nLines );
+        return 0;
+    }
+    Vec_IntClear( p->vFanins );
+    for ( i = 1; i <= nFanins; i++ )
+    {
+        NameFanin = Io_BlifGiaNameId( p, (char *)Vec_PtrEntry(p->vTokens, i) );
+        Vec_IntPush( p->vFanins, NameFanin );
+        fReady &= (Io_BlifGiaNameLit(p, NameFanin) >= 0);
+    }
+    NameId = Io_BlifGiaNameId( p, (char *)Vec_PtrEntryLast(p->vTokens) );
+    if ( Io_BlifGiaNameIsDefined(p, NameId) )
+    {
+        snprintf( p->sError, sizeof(p->sError), "Line %d: Signal (%.200s) is defined more than once.", p->nLines, (char *)Vec_PtrEntryLast(p->vTokens) );
+        return 0;
+    }
+    // read the cubes into the SOP
+    Vec_StrClear( p->vSop );
+    while ( Io_BlifGiaReadLine(p) )
+    {
+        pProduct = (char *)Vec_PtrEntry( p->vTokens, 0 );
+        if ( pProduct[0] == '.' )
+        {
+            p->fUnread = 1;
+            break;
+        }
+        if ( Vec_PtrSize(p->vTokens) != 1 + (nFanins > 0) )
+        {
+            snprintf( p->sError, sizeof(p->sError), "Line %d: Table has wrong number of tokens (%d).", p->nLines, Vec_PtrSize(p->vTokens) );
+            return 0;
+        }
+        pOutput = (char *)Vec_PtrEntryLast( p->vTokens );
+        if ( nFanins > 0 && strlen(pProduct) != (unsigned)nFanins )
+        {
+            snprintf( p->sError, sizeof(p->sError), "Line %d: Cube (%.200s) has size different from the fanin count (%d).", p->nLines, pProduct, nFanins );
+            return 0;
+        }
+        for ( i = 0; i < nFanins; i++ )
+            if ( pProduct[i] != '0' && pProduct[i] != '1' && pProduct[i] != '-' )
+            {
+                snprintf( p->sError, sizeof(p->sError), "Line %d: Product term (%.200s) contains character (%c).", p->nLines, pProduct, pProduct[i] );
+                return 0;
+            }
+        if ( ((pOutput[0] - '0') & 0x8E) || pOutput[1] )
+        {
+            snprintf( p->sError, sizeof(p->sError), "Line %d: Output value (%.200s) is incorrect.", p->nLines, pOutput );
+            return 0;
+        }
+        if ( Polarity == -1 )
+            Polarity = pOutput[0] - '0';
+        else if ( Polarity != pOutput[0] - '0' )
+        {
+            snprintf( p->sError, sizeof(p->sError), "Line %d: Output value (%.200s) differs from the value in the first line of the table (%d).", p->nLines, pOutput, Polarity );
+            return 0;
+        }
+        if ( nFanins > 0 )
+            Vec_StrPrintStr( p->vSop, pProduct );
+        Vec_StrPush( p->vSop, ' ' );
+        Vec_StrPush( p->vSop, pOutput[0] );
+        Vec_StrPush( p->vSop, '\n' );
+    }
+    Vec_StrPush( p->vSop, '\0' );
+    // build the table right away if the fanins are known
+    if ( fReady )
+    {
+        Vec_IntClear( p->vLits );
+        Vec_IntForEachEntry( p->vFanins, NameFanin, i )
+            Vec_IntPush( p->vLits, Io_BlifGiaNameLit(p, NameFanin) );
+        Vec_IntWriteEntry( p->vName2Lit, NameId, Io_BlifGiaBuildSop(p, Vec_StrArray(p->vSop), p->vLits) );
+        return 1;
+    }
+    // otherwise, save it until the fanins are known
+    p->nTablesPend++;
+    Vec_IntWriteEntry( p->vName2Pend, NameId, Vec_IntSize(p->vPend) );
+    Vec_IntPush( p->vPend, NameId );
+    Vec_IntPush( p->vPend, Vec_StrSize(p->vPendSop) );
+    Vec_IntPush( p->vPend, nFanins );
+    Vec_IntAppend( p->vPend, p->vFanins );
+    Vec_StrPrintStr( p->vPendSop, Vec_StrArray(p->vSop) );
+    Vec_StrPush( p->vPendSop, '\0' );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Parses the interface lines.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Io_BlifGiaParseInputs( Io_BlifGia_t * p )
+{
+    char * pToken;
+    int i, NameId;
+    if ( Vec_IntSize(p->vLos) > 0 )
+    {
+        snprintf( p->sError, sizeof(p->sError), "Line %d: Primary inputs are listed after the latches (try \"read_blif\").", p->nLines );
+        return 0;
+    }
+    Vec_PtrForEachEntryStart( char *, p->vTokens, pToken, i, 1 )
+    {
+        NameId = Io_BlifGiaNameId( p, pToken );
+        if ( Io_BlifGiaNameIsDefined(p, NameId) )
+        {
+            snprintf( p->sError, sizeof(p->sError), "Line %d: Primary input (%.200s) is defined more than once.", p->nLines, pToken );
+            return 0;
+        }
+        Vec_IntWriteEntry( p->vName2Lit, NameId, Gia_ManAppendCi(p->pGia) );
+        Vec_IntPush( p->vPis, NameId );
+    }
+    return 1;
+}
+static int Io_BlifGiaParseOutputs( Io_BlifGia_t * p )
+{
+    char * pToken;
+    int i;
+    Vec_PtrForEachEntryStart( char *, p->vTokens, pToken, i, 1 )
+        Vec_IntPush( p->vPos, Io_BlifGiaNameId(p, pToken) );
+    return 1;
+}
+static int Io_BlifGiaParseLatch( Io_BlifGia_t * p )
+{
+    int NameId, Init = 2;
+    if ( Vec_PtrSize(p->vTokens) < 3 )
+    {
+        snprintf( p->sError, sizeof(p->sError), "Line %d: Latch does not have input name and output name.", p->nLines );
+        return 0;
+    }
+    if ( Vec_PtrSize(p->vTokens) > 3 )
+        Init = atoi( (char *)Vec_PtrEntryLast(p->vTokens) );
+    if ( Init < 0 || Init > 3 )
+    {
+        snprintf( p->sError, sizeof(p->sError), "Line %d: Initial state of the latch is incorrect (%.200s).", p->nLines, (char *)Vec_PtrEntryLast(p->vTokens) );
+        return 0;
+    }
+    NameId = Io_BlifGiaNameId( p, (char *)Vec_PtrEntry(p->vTokens, 2) );
+    if ( Io_BlifGiaNameIsDefined(p, NameId) )
+    {
+        snprintf( p->sError, sizeof(p->sError), "Line %d: Latch output (%.200s) is defined more than once.", p->nLines, (char *)Vec_PtrEntry(p->vTokens, 2) );
+        return 0;
+    }
+    // latches with initial state 1 are complemented, so that all of them start at 0
+    p->nInitDc += (Init >= 2);
+    Vec_IntWriteEntry( p->vName2Lit, NameId, Abc_LitNotCond(Gia_ManAppendCi(p->pGia), Init == 1) );
+    Vec_IntPush( p->vLos, NameId );
+    Vec_IntPush( p->vLis, Io_BlifGiaNameId(p, (char *)Vec_PtrEntry(p->vTokens, 1)) );
+    Vec_IntPush( p->vInits, Init );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Builds the pending tables in the TFI of the name.]
+
+  Description [Uses an explicit stack, so that long chains of tables
+  listed in the reverse topological order do not overflow the stack.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Io_BlifGiaResolve( Io_BlifGia_t * p, int NameId )
+{
+    int * pPend;
+    int i, Top, fReady;
+    Vec_IntClear( p->vStack );
+    Vec_IntPush( p->vStack, NameId );
+    while ( Vec_IntSize(p->vStack) )
+    {
+        Top = Vec_IntEntryLast( p->vStack );
+        if ( Io_BlifGiaNameLit(p, Top) >= 0 )
+        {
+            Vec_IntPop( p->vStack );
+            continue;
+        }
+        if ( Vec_IntEntry(p->vName2Pend, Top) < 0 )
+        {
+            snprintf( p->sError, sizeof(p->sError), "Signal (%.200s) is not defined as a table.", Abc_NamStr(p->pNames, Top) );
+            return -1;
+        }
+        pPend = Vec_IntEntryP( p->vPend, Vec_IntEntry(p->vName2Pend, Top) );
+        assert( pPend[0] == Top );
+        // push the fanins that are not built yet
+        fReady = 1;
+        for ( i = 0; i < pPend[2]; i++ )
+        {
+            if ( Io_BlifGiaNameLit(p, pPend[3+i]) >= 0 )
+                continue;
+            if ( Vec_IntEntry(p->vMarks, pPend[3+i]) )
+            {
+                snprintf( p->sError, sizeof(p->sError), "Signal (%.200s) appears twice on a combinational path.", Abc_NamStr(p->pNames, pPend[3+i]) );
+                return -1;
+            }
+            Vec_IntPush( p->vStack, pPend[3+i] );
+            fReady = 0;
+        }
+        if ( !fReady )
+        {
+            Vec_IntWriteEntry( p->vMarks, Top, 1 );
+            continue;
+        }
+        // build the table
+        Vec_IntClear( p->vLits );
+        for ( i = 0; i < pPend[2]; i++ )
+            Vec_IntPush( p->vLits, Io_BlifGiaNameLit(p, pPend[3+i]) );
+        Vec_IntWriteEntry( p->vName2Lit, Top, Io_BlifGiaBuildSop(p, Vec_StrEntryP(p->vPendSop, pPend[1]), p->vLits) );
+        Vec_IntWriteEntry( p->vMarks, Top, 0 );
+        Vec_IntPop( p->vStack );
+    }
+    return Io_BlifGiaNameLit( p, NameId );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Parses the file.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Io_BlifGiaParse( Io_BlifGia_t * p )
+{
+    char * pToken;
+    int i, NameId, Lit;
+    while ( Io_BlifGiaReadLine(p) )
+    {
+        pToken = (char *)Vec_PtrEntry( p->vTokens, 0 );
+        if ( !strcmp(pToken, ".names") )
+        {
+            if ( !Io_BlifGiaParseNames(p) )
+                return 0;
+        }
+        else if ( !strcmp(pToken, ".latch") )
+        {
+            if ( !Io_BlifGiaParseLatch(p) )
+                return 0;
+        }
+        else if ( !strcmp(pToken, ".inputs") )
+        {
+            if ( !Io_BlifGiaParseInputs(p) )
+                return 0;
+        }
+        else if ( !strcmp(pToken, ".outputs") )
+        {
+            if ( !Io_BlifGiaParseOutputs(p) )
+                return 0;
+        }
+        else if ( !strcmp(pToken, ".model") )
+        {
+            if ( p->pModel != NULL )
+            {
+                snprintf( p->sError, sizeof(p->sError), "Line %d: The file contains more than one model (try \"&read_blif\" without \"-s\").", p->nLines );
+                return 0;
+            }
+            p->pModel = Abc_UtilStrsav( Vec_PtrSize(p->vTokens) > 1 ? (char *)Vec_PtrEntry(p->vTokens, 1) : p->pFileName );
+        }
+        else if ( !strcmp(pToken, ".end") || !strcmp(pToken, ".exdc") )
+            break;
+        else if ( !strcmp(pToken, ".subckt") || !strcmp(pToken, ".gate") || !strcmp(pToken, ".mlatch") )
+        {
+            snprintf( p->sError, sizeof(p->sError), "Line %d: Directive \"%.200s\" is not supported (try \"read_blif\").", p->nLines, pToken );
+            return 0;
+        }
+        else if ( pToken[0] == '.' )
+            fprintf( stdout, "Line %d: Skipping line \"%s\".\n", p->nLines, pToken );
+        else
+        {
+            snprintf( p->sError, sizeof(p->sError), "Line %d: Cube (%.200s) does not belong to a table.", p->nLines, pToken );
+            return 0;
+        }
+    }
+    // build the pending tables in the TFI of the COs and create the COs
+    Vec_IntFill( p->vMarks, Vec_IntSize(p->vName2Lit), 0 );
+    Vec_IntForEachEntry( p->vPos, NameId, i )
+    {
+        if ( (Lit = Io_BlifGiaResolve(p, NameId)) < 0 )
+            return 0;
+        Gia_ManAppendCo( p->pGia, Lit );
+    }
+    Vec_IntForEachEntry( p->vLis, NameId, i )
+    {
+        if ( (Lit = Io_BlifGiaResolve(p, NameId)) < 0 )
+            return 0;
+        Gia_ManAppendCo( p->pGia, Abc_LitNotCond(Lit, Vec_IntEntry(p->vInits, i) == 1) );
+    }
+    Gia_ManSetRegNum( p->pGia, Vec_IntSize(p->vLos) );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the flat BLIF file directly into the GIA.]
+
+  Description [The file is read line by line, and each table is
+  factored and strashed into the AIG as soon as its fanins are known.
+  Only the signal names and the tables listed before their fanins
+  are stored in addition to the AIG.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Io_ReadBlifAsGia( char * pFileName, int fVerbose )
+{
+    Io_BlifGia_t * p;
+    Gia_Man_t * pGia, * pTemp;
+    FILE * pFile;
+    int i, NameId, RetValue;
+    abctime clk = Abc_Clock();
+    pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+    {
+        printf( "Io_ReadBlifAsGia(): The file is unavailable (absent or open).\n" );
+        return NULL;
+    }
+    p = Io_BlifGiaAlloc( pFileName, pFile );
+    RetValue = Io_BlifGiaParse( p );
+    fclose( pFile );
+    if ( !RetValue )
+    {
+        fprintf( stdout, "%s\n", p->sError );
+        Io_BlifGiaFree( p );
+        return NULL;
+    }
+    Gia_ManHashStop( p->pGia );
+    if ( p->nInitDc )
+        printf( "Warning: %d latches with don't-care initial state are initialized to 0.\n", p->nInitDc );
+    if ( fVerbose )
+    {
+        printf( "Lines = %d.  Names = %d.  Tables = %d.  Pending tables = %d.  AND nodes = %d.\n",
+            p->nLines, Abc_NamObjNumMax(p->pNames) - 1, p->nTables, p->nTablesPend, Gia_ManAndNum(p->pGia) );
+        printf( "Memory:  AIG = %.2f MB.  Names = %.2f MB.  Pending = %.2f MB.  ",
+            1.0 * Gia_ManObjNum(p->pGia) * sizeof(Gia_Obj_t) / (1<<20),
+            1.0 * (Abc_NamMemAlloc(p->pNames) + 8 * Vec_IntCap(p->vName2Lit)) / (1<<20),
+            1.0 * (4 * Vec_IntCap(p->vPend) + Vec_StrCap(p->vPendSop)) / (1<<20) );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    // remove the tables that do not feed into the COs
+    pGia = p->pGia;
+    p->pGia = NULL;
+    if ( Gia_ManHasDangling(pGia) )
+    {
+        pGia = Gia_ManCleanup( pTemp = pGia );
+        Gia_ManStop( pTemp );
+    }
+    pGia->pName = Abc_UtilStrsav( p->pModel ? p->pModel : pFileName );
+    pGia->pSpec = Abc_UtilStrsav( pFileName );
+    // save the names of the combinational inputs and outputs
+    pGia->vNamesIn  = Vec_PtrAlloc( Gia_ManCiNum(pGia) );
+    pGia->vNamesOut = Vec_PtrAlloc( Gia_ManCoNum(pGia) );
+    Vec_IntForEachEntry( p->vPis, NameId, i )
+        Vec_PtrPush( pGia->vNamesIn, Abc_UtilStrsav(Abc_NamStr(p->pNames, NameId)) );
+    Vec_IntForEachEntry( p->vLos, NameId, i )
+        Vec_PtrPush( pGia->vNamesIn, Abc_UtilStrsav(Abc_NamStr(p->pNames, NameId)) );
+    Vec_IntForEachEntry( p->vPos, NameId, i )
+        Vec_PtrPush( pGia->vNamesOut, Abc_UtilStrsav(Abc_NamStr(p->pNames, NameId)) );
+    Vec_IntForEachEntry( p->vLis, NameId, i )
+        Vec_PtrPush( pGia->vNamesOut, Abc_UtilStrsav(Abc_NamStr(p->pNames, NameId)) );
+    Io_BlifGiaFree( p );
+    return pGia;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
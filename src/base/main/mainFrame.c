@@ -606,9 +606,10 @@ void Abc_FrameDeleteAllNetworks( Abc_Frame_t * p )
 //    fprintf( p->Out, "All networks have been deleted.\n" );
     Gia_ManStopP( &p->pGia );
     Gia_ManStopP( &p->pGia2 );
-    Gia_ManStopP( &p->pGiaBest );
-    Gia_ManStopP( &p->pGiaBest2 );
-    Gia_ManStopP( &p->pGiaSaved );
+    Gia_SnapStopP( &p->pGiaBest );
+    Gia_SnapStopP( &p->pGiaBest2 );
+    Gia_SnapStopP( &p->pGiaSaved );
+    Gia_SnapStopVec( &p->vGiaSnaps );
 }
 
 /**Function*************************************************************
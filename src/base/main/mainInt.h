@@ -114,9 +114,10 @@ struct Abc_Frame_t_
     // new code
     Gia_Man_t *     pGia;          // alternative current network as a light-weight AIG
     Gia_Man_t *     pGia2;         // copy of the above
-    Gia_Man_t *     pGiaBest;      // copy of the above
-    Gia_Man_t *     pGiaBest2;     // copy of the above
-    Gia_Man_t *     pGiaSaved;     // copy of the above
+    Gia_Snap_t *    pGiaBest;      // compressed copy of the above
+    Gia_Snap_t *    pGiaBest2;     // compressed copy of the above
+    Gia_Snap_t *    pGiaSaved;     // compressed copy of the above
+    Vec_Ptr_t *     vGiaSnaps;     // compressed copies saved by &snap
     int             nBestLuts;     // best LUT count
     int             nBestEdges;    // best edge count
     int             nBestLevels;   // best level count
@@ -0,0 +1,14 @@
+#ifndef LSV_BENCH_H
+#define LSV_BENCH_H
+
+// SAT effort of the LSV commands, the engines add to it when they finish
+// and lsv_bench clears it before every run
+struct lsvsatstats{
+  long nSolves;
+  long nConflicts;
+  long nPropagations;
+};
+
+extern lsvsatstats Lsv_BenchSat;
+
+#endif
@@ -1,6 +1,7 @@
 #include "base/abc/abc.h"
 #include "base/main/main.h"
 #include "base/main/mainInt.h"
+#include "ext-lsv/lsvJson.h"
 
 static int Lsv_CommandPrintNodes(Abc_Frame_t* pAbc, int argc, char** argv);
 
@@ -16,6 +17,30 @@ struct PackageRegistrationManager {
   PackageRegistrationManager() { Abc_FrameAddInitializer(&frame_initializer); }
 } lsvPackageRegistrationManager;
 
+// one line per node: id, name, fanin ids and names, and the SOP when there is one
+void Lsv_NtkWriteNodesJson(Abc_Ntk_t* pNtk, lsvjson* pJson) {
+  Abc_Obj_t* pObj, * pFanin;
+  int i, j;
+  std::vector<int> ids;
+  std::vector<char*> names;
+  Abc_NtkForEachNode(pNtk, pObj, i) {
+    ids.clear();
+    names.clear();
+    Abc_ObjForEachFanin(pObj, pFanin, j) {
+      ids.push_back(Abc_ObjId(pFanin));
+      names.push_back(Abc_ObjName(pFanin));
+    }
+    Lsv_JsonBegin(pJson);
+    Lsv_JsonInt(pJson, "id", Abc_ObjId(pObj));
+    Lsv_JsonStr(pJson, "name", Abc_ObjName(pObj));
+    Lsv_JsonIntArray(pJson, "fanin_ids", ids);
+    Lsv_JsonStrArray(pJson, "fanin_names", names);
+    if (Abc_NtkHasSop(pNtk))
+      Lsv_JsonStr(pJson, "sop", (char*)pObj->pData);
+    Lsv_JsonEnd(pJson);
+  }
+}
+
 void Lsv_NtkPrintNodes(Abc_Ntk_t* pNtk) {
   Abc_Obj_t* pObj;
   int i;
@@ -36,9 +61,18 @@ void Lsv_NtkPrintNodes(Abc_Ntk_t* pNtk) {
 int Lsv_CommandPrintNodes(Abc_Frame_t* pAbc, int argc, char** argv) {
   Abc_Ntk_t* pNtk = Abc_FrameReadNtk(pAbc);
   int c;
+  char* pJsonFile = NULL;
   Extra_UtilGetoptReset();
-  while ((c = Extra_UtilGetopt(argc, argv, "h")) != EOF) {
+  while ((c = Extra_UtilGetopt(argc, argv, "jh")) != EOF) {
     switch (c) {
+      case 'j':
+        if (globalUtilOptind >= argc) {
+          Abc_Print(-1, "Command line switch \"-j\" should be followed by a file name.\n");
+          goto usage;
+        }
+        pJsonFile = argv[globalUtilOptind];
+        globalUtilOptind++;
+        break;
       case 'h':
         goto usage;
       default:
@@ -49,12 +83,21 @@ int Lsv_CommandPrintNodes(Abc_Frame_t* pAbc, int argc, char** argv) {
     Abc_Print(-1, "Empty network.\n");
     return 1;
   }
+  if (pJsonFile) {
+    lsvjson* pJson = Lsv_JsonOpen(pJsonFile);
+    if (pJson == NULL)
+      return 1;
+    Lsv_NtkWriteNodesJson(pNtk, pJson);
+    Lsv_JsonClose(pJson);
+    return 0;
+  }
   Lsv_NtkPrintNodes(pNtk);
   return 0;
 
 usage:
-  Abc_Print(-2, "usage: lsv_print_nodes [-h]\n");
+  Abc_Print(-2, "usage: lsv_print_nodes [-j file] [-h]\n");
   Abc_Print(-2, "\t        prints the nodes in the network\n");
+  Abc_Print(-2, "\t-j file: write the nodes to the file as JSON lines instead\n");
   Abc_Print(-2, "\t-h    : print the command usage\n");
   return 1;
 }
\ No newline at end of file
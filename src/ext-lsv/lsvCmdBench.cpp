@@ -0,0 +1,188 @@
+#include "base/abc/abc.h"
+#include "base/main/main.h"
+#include "base/main/mainInt.h"
+#include "ext-lsv/lsvBench.h"
+#include <string.h>
+#include <string>
+
+#if defined(LIN) || defined(LIN64)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#endif
+
+using namespace std;
+
+lsvsatstats Lsv_BenchSat;
+
+static int Lsv_CommandBench(Abc_Frame_t* pAbc, int argc, char** argv);
+
+void initbench(Abc_Frame_t* pAbc) {
+  Cmd_CommandAdd(pAbc, "LSV", "lsv_bench", Lsv_CommandBench, 0);
+}
+
+void destroybench(Abc_Frame_t* pAbc) {}
+
+Abc_FrameInitializer_t frame_initializerbench = {initbench, destroybench};
+
+struct PackageRegistrationManagerbench {
+  PackageRegistrationManagerbench() { Abc_FrameAddInitializer(&frame_initializerbench); }
+} lsvPackageRegistrationManagerbench;
+
+// resets the peak RSS of the process so that the next reading covers one run,
+// without it (old kernels, no /proc) every run reports the peak of the whole process
+static void Lsv_BenchResetPeak(){
+  FILE* pFile = fopen("/proc/self/clear_refs", "w");
+  if(pFile == NULL) return;
+  fputs("5", pFile);
+  fclose(pFile);
+}
+
+// peak RSS in kB
+static long Lsv_BenchPeakRss(){
+  char Buffer[256];
+  long PeakKb = -1;
+  FILE* pFile = fopen("/proc/self/status", "r");
+  if(pFile){
+    while(fgets(Buffer, sizeof(Buffer), pFile)){
+      if(strncmp(Buffer, "VmHWM:", 6) == 0){
+        PeakKb = atol(Buffer + 6);
+        break;
+      }
+    }
+    fclose(pFile);
+  }
+#if defined(LIN) || defined(LIN64)
+  if(PeakKb < 0){
+    struct rusage Usage;
+    getrusage(RUSAGE_SELF, &Usage);
+    PeakKb = Usage.ru_maxrss;
+  }
+#endif
+  return PeakKb;
+}
+
+// one CSV field, quoted when it has a separator or a quote
+static void Lsv_BenchWriteField(FILE* pFile, const char* pStr){
+  if(strpbrk(pStr, ",\"\n") == NULL){
+    fputs(pStr, pFile);
+    return;
+  }
+  fputc('"', pFile);
+  for(const char* c = pStr; *c; c++){
+    if(*c == '"') fputc('"', pFile);
+    fputc(*c, pFile);
+  }
+  fputc('"', pFile);
+}
+
+int Lsv_CommandBench(Abc_Frame_t* pAbc, int argc, char** argv) {
+  Abc_Ntk_t* pNtk = Abc_FrameReadNtk(pAbc);
+  int c, i, nRuns = 3, fQuiet = 1;
+  char* pFileName = NULL;
+  Extra_UtilGetoptReset();
+  while ((c = Extra_UtilGetopt(argc, argv, "Noqh")) != EOF) {
+    switch (c) {
+      case 'N':
+        if (globalUtilOptind >= argc) {
+          Abc_Print(-1, "Command line switch \"-N\" should be followed by an integer.\n");
+          goto usage;
+        }
+        nRuns = atoi(argv[globalUtilOptind]);
+        globalUtilOptind++;
+        if (nRuns < 1)
+          goto usage;
+        break;
+      case 'o':
+        if (globalUtilOptind >= argc) {
+          Abc_Print(-1, "Command line switch \"-o\" should be followed by a file name.\n");
+          goto usage;
+        }
+        pFileName = argv[globalUtilOptind];
+        globalUtilOptind++;
+        break;
+      case 'q':
+        fQuiet ^= 1;
+        break;
+      case 'h':
+        goto usage;
+      default:
+        goto usage;
+    }
+  }
+  if (globalUtilOptind >= argc) {
+    Abc_Print(-1, "The command to run is missing.\n");
+    goto usage;
+  }
+  if (!pNtk) {
+    Abc_Print(-1, "Empty network.\n");
+    return 1;
+  }
+  {
+    string Command;
+    for (i = globalUtilOptind; i < argc; i++) {
+      if (i > globalUtilOptind) Command += ' ';
+      Command += argv[i];
+    }
+    // the network name is saved, the command may replace the current network
+    string NtkName = Abc_NtkSpec(pNtk) ? Abc_NtkSpec(pNtk) : Abc_NtkName(pNtk);
+    FILE* pFile = stdout;
+    if (pFileName) {
+      pFile = fopen(pFileName, "a");
+      if (pFile == NULL) {
+        Abc_Print(-1, "Cannot open file \"%s\" for writing.\n", pFileName);
+        return 1;
+      }
+    }
+    if (pFile == stdout || ftell(pFile) == 0)
+      fprintf(pFile, "network,command,run,status,wall_s,cpu_s,peak_rss_kb,sat_calls,conflicts,propagations\n");
+    for (i = 0; i < nRuns; i++) {
+      int fdSaved = -1, Status;
+      memset(&Lsv_BenchSat, 0, sizeof(lsvsatstats));
+      Lsv_BenchResetPeak();
+      // the output of the command goes to /dev/null, it would dominate the time otherwise
+      fflush(stdout);
+#if defined(LIN) || defined(LIN64)
+      if (fQuiet) {
+        int fdNull = open("/dev/null", O_WRONLY);
+        if (fdNull >= 0) {
+          fdSaved = dup(1);
+          dup2(fdNull, 1);
+          close(fdNull);
+        }
+      }
+#endif
+      // wall clock, Abc_Clock() only counts the CPU time of the calling thread
+      abctime Wall = Abc_ClockWall();
+      abctime clk = Abc_Clock();
+      Status = Cmd_CommandExecute(pAbc, Command.c_str());
+      clk = Abc_Clock() - clk;
+      Wall = Abc_ClockWall() - Wall;
+      fflush(stdout);
+#if defined(LIN) || defined(LIN64)
+      if (fdSaved >= 0) {
+        dup2(fdSaved, 1);
+        close(fdSaved);
+      }
+#endif
+      Lsv_BenchWriteField(pFile, NtkName.c_str());
+      fputc(',', pFile);
+      Lsv_BenchWriteField(pFile, Command.c_str());
+      fprintf(pFile, ",%d,%d,%.4f,%.4f,%ld,%ld,%ld,%ld\n", i, Status, 1.0 * Wall / CLOCKS_PER_SEC, 1.0 * clk / CLOCKS_PER_SEC,
+              Lsv_BenchPeakRss(), Lsv_BenchSat.nSolves, Lsv_BenchSat.nConflicts, Lsv_BenchSat.nPropagations);
+    }
+    if (pFile != stdout)
+      fclose(pFile);
+  }
+  return 0;
+
+usage:
+  Abc_Print(-2, "usage: lsv_bench [-N num] [-o file] [-qh] <command>\n");
+  Abc_Print(-2, "\t        runs an LSV command on the current network and writes one CSV line per run\n");
+  Abc_Print(-2, "\t        with wall and CPU time, peak RSS, SAT calls, conflicts and propagations\n");
+  Abc_Print(-2, "\t-N num : the number of runs [default = %d]\n", nRuns);
+  Abc_Print(-2, "\t-o file: append the lines to the file, a new file gets a header [default = stdout]\n");
+  Abc_Print(-2, "\t-q    : toggle discarding the output of the command [default = %s]\n", fQuiet ? "yes" : "no");
+  Abc_Print(-2, "\t-h    : print the command usage\n");
+  return 1;
+}
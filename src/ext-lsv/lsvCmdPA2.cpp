@@ -4,12 +4,18 @@
 #include "sat/cnf/cnf.h"
 #include "proof/fra/fra.h"
 #include "sat/glucose/AbcGlucose.h"
-#include "base/abc/abc.h"
-#include "base/main/main.h"
+#include "aig/gia/gia.h"
+#include "aig/gia/giaAig.h"
+#include "ext-lsv/lsvJson.h"
+#include "ext-lsv/lsvBench.h"
 #include <iostream>
 #include <string.h>
 #include <vector>
 #include <unordered_map>
+#include <algorithm>
+#ifdef ABC_USE_PTHREADS
+#include <pthread.h>
+#endif
 using namespace std;
 
 static int Lsv_CommandPrintpounate(Abc_Frame_t* pAbc, int argc, char** argv);
@@ -28,206 +34,679 @@ struct PackageRegistrationManagerpounate {
 
 // initial ok
 
-struct inputnode{
-  //ID = -1, mean doesn't have it
-  int initID;
-  int coneID;
-  char* name;
+struct unatepars{
+  int fStructural; // skip the solves proved by structural unateness
+  int nSimWords;   // words of random simulation before SAT, 0 = off
+  int nThreads;    // worker threads of the per-cone engine, 1 = serial
+  int nTtVars;     // COs with at most this many support inputs use truth tables, 0 = off
+  int fVerbose;
+  int fIncremental; // one solver for all POs instead of one per cone
+  int iCarePo;     // PO whose onset is the care set, -1 = no don't-cares
+  lsvjson* pJson;  // JSON-lines output, NULL prints the text
+  int fQuiet;      // print nothing, used to time the other engine
+  int fCompare;    // also run the other engine silently and print both times
+};
+
+// which stage settled the (PO,PI) queries, PIs outside the support are not counted
+struct unatestats{
+  int nQueries;
+  int nStructUnate; // one polarity proved by the structural pass
+  int nSimBinate;   // both witnesses seen in simulation
+  int nTruthTable;  // settled by the truth table of a small-support CO
+  int nNoSolve;     // settled without any solve
+  int nSatSolves;
+  long nConflicts;
+  long nPropagations;
+};
+
+// one PO, prepared by the main thread and solved by a worker
+// types[pi] uses the values of Gia_ManCheckUnate(): 0 binate, 1 neg-unate, 2 pos-unate, 3 both
+struct pojob{
+  int iPo;
+  vector<int> supp;      // CI indices of the support, empty when there is nothing to solve
+  const char* pProved;   // structural unateness of each PI, NULL when there is no structural pass
+  const char* pWitness;  // simulation witnesses of each PI, NULL when there is no simulation
+  vector<char> types;
+  unatestats stats;
+};
+
+// CNF of a GIA loaded on demand into one solver as a dual-rail miter: every object gets
+// a variable in copy 0 for F(x) and in copy 1 for F(x'), and every CI an enable that makes
+// x == x', Cnf_Inc_t loads an object the first time a cone reaches it, so the logic shared
+// by several POs is encoded once and no cone is ever copied out of the network
+// with a care set C both copies are constrained to C=1, so a witness that the cofactors
+// differ must lie in the care set of both of them
+struct lsvcone{
+  Gia_Man_t* pGia;       // only read, several managers can share it
+  Cnf_Inc_t* pInc;       // both copies of the GIA, the CNF it loads from is only read
+  int iCareCo;           // CO of the care set, -1 when there is none
+  vector<int> careSupp;  // its support as sorted CI indices
+  sat_solver* pSat;      // the solver of pInc
+  vector<int> enVar;     // enable variable of each CI, -1 when not created
+  vector<int> enabled;   // CIs with an enable since the last restart
 };
 
 extern "C" Aig_Man_t * Abc_NtkToDar( Abc_Ntk_t * pNtk, int fExors, int fRegisters );
-extern "C" Cnf_Dat_t * Cnf_Derive(Aig_Man_t *pAig, int nOutputs);
-
-void Lsv_NtkPrintpounate(Abc_Ntk_t* pNtk) {
-  Abc_Obj_t* allPi;
-  int i;
-  int maxPiID=0;
-  //get maxPiID
-  Abc_NtkForEachPi(pNtk,allPi,i){
-    if(Abc_ObjId(allPi)>maxPiID) maxPiID = Abc_ObjId(allPi);
-  }
-  inputnode Pinode[ maxPiID+1 ];
-  unordered_map<string,int> name2initID;
-  //init it
-  for(i=0;i<maxPiID+1;i++){
-    Pinode[i].initID = -1;
-  }
-  //put name, initID, won't change
-  Abc_NtkForEachPi(pNtk,allPi,i){
-    Pinode[Abc_ObjId(allPi)].initID = Abc_ObjId(allPi);
-    Pinode[Abc_ObjId(allPi)].name = Abc_ObjName(allPi);
-    name2initID[Abc_ObjName(allPi)] = Abc_ObjId(allPi);
-  }
-  //for each PO do it
-  Abc_Obj_t* PO;
-  Abc_NtkForEachPo(pNtk, PO, i){
-    cout<<"node "<<Abc_ObjName(PO)<<":\n";
-    // POnode != PO, PO only 1 input: POnode
-    Abc_Obj_t* POnode = Abc_NtkFindNode(pNtk,Abc_ObjName(PO));
-    // original i use phase function, but other people say this is good, so I use it, not really understand
-    // how this function work, but it is correct
-    bool isComplment = Abc_ObjFaninC0(PO);
-    //but cone id may not be true, it will rerange to 1~n-1, n and only one output
-    Abc_Ntk_t* cone = Abc_NtkCreateCone(pNtk,POnode,Abc_ObjName(POnode),0);
-    //get Pi number
-    int Cinum = Abc_NtkPiNum(cone);
-    //init Pinode coneID
-    int j;
-    for(j=0;j<maxPiID+1;j++){
-      Pinode[j].coneID = -1;
-    }
-    //update coneID
-    Abc_Obj_t* PI;
-    Abc_NtkForEachPi(cone, PI, j) {
-      //cerr<<Abc_ObjName(PI)<<" "<<Abc_ObjId(PI)<<endl;
-      //cerr<<name2initID[Abc_ObjName(PI)]<<endl;
-      Pinode[ name2initID[Abc_ObjName(PI)] ].coneID = Abc_ObjId(PI);
-      //printf("cone Priamy input-%d: name: %s , Id = %d\n", j+1, Abc_ObjName(PI), Abc_ObjId(PI));
-      //printf("cone Priamy input-%d: name: %s , Id = %d\n", j+1, Pinode[j+1].name, Abc_ObjId(PI));
-    }
-    // check unordered map have success do
-    // for(j=0;j<maxPiID+1;j++){
-    //   if(Pinode[j].initID != -1){
-    //     cerr<<j;
-    //     cerr<<" initID: "<<Pinode[j].initID;
-    //     cerr<<" coneID: "<<Pinode[j].coneID;
-    //     cerr<<" name: "<<Pinode[j].name<<endl;
-    //   }
-    // }
-    //change to aig
-    Aig_Man_t* coneaig = Abc_NtkToDar(cone,0,0);
-    //because only one output, 0 mean CO index
-    Aig_Obj_t* coneaig_CO = Aig_ManCo(coneaig,0);
-    // I think ID have one to one 
-    //debug use
-    // Abc_Obj_t* PI;
-    // int j;
-    // Abc_NtkForEachPi(pNtk, PI, j) {
-    //   printf("pNtk Priamy input-%d: name: %s , Id = %d\n", j, Abc_ObjName(PI), Abc_ObjId(PI));
-    // }
-    // Abc_NtkForEachPi(cone, PI, j) {
-    //   printf("Priamy input-%d: name: %s , Id = %d\n", j, Abc_ObjName(PI), Abc_ObjId(PI));
-    // }
-    // //debug use
-    // Aig_Obj_t* Ci;
-    // Aig_ManForEachCi(coneaig,Ci,j){
-    //   printf("Priamy input-%d: Id = %d\n", j,Aig_ObjId(Ci));
-    // } 
-    
-    //F
-    Cnf_Dat_t* cnfconeaig = Cnf_Derive(coneaig,1);
-    //copy same F than can use later to F(~x)
-    Cnf_Dat_t* negcnfconeaig = Cnf_DataDup(cnfconeaig);
-    //move F(~x) node ID to n+1 ~ 2n
-    Cnf_DataLift(negcnfconeaig, cnfconeaig->nVars);
-    //cout<<cnfconeaig->nVars<<endl;
-    //SAT
-    sat_solver* pSat = sat_solver_new();
-    //need more numCI var to use buffer_enable
-    int offset = 2*(cnfconeaig->nVars);
-    sat_solver_setnvars(pSat,offset+Aig_ManCiNum(coneaig)+1);
-    //add clause
-    for(int k=0;k<cnfconeaig->nClauses;k++){
-      sat_solver_addclause(pSat,cnfconeaig->pClauses[k],cnfconeaig->pClauses[k+1]);
-      sat_solver_addclause(pSat,negcnfconeaig->pClauses[k],negcnfconeaig->pClauses[k+1]);
-    }
-    //add equivalent buffer
-    for(int j=1;j<=Aig_ManCiNum(coneaig);j++){
-      sat_solver_add_buffer_enable(pSat,cnfconeaig->pVarNums[j],negcnfconeaig->pVarNums[j],offset+j-1,0);
-    }
-    //add and for positive F(x) = 0 and F(~x) = 1
-    //sat_solver_add_and(pSat,out,in1,in2,cin1,cin2,cout)
-    sat_solver_add_and(pSat,offset+Aig_ManCiNum(coneaig),cnfconeaig->pVarNums[coneaig_CO->Id],negcnfconeaig->pVarNums[coneaig_CO->Id],1,0,0);
-    //add and for negitive F(x) = 1 and F(~x) = 0
-    //sat_solver_add_and(pSat,offset+Aig_ManCiNum(coneaig)+1,cnfconeaig->pVarNums[coneaig_CO->Id],negcnfconeaig->pVarNums[coneaig_CO->Id],0,1,0);
-    //make assume lit
-    //0~2 use to another, 3~N+2 use to enable
-    //toLitCond(XXX,0) mean set XXX=1
-    lit assume[Cinum+3];
-    for(int j=0;j<Aig_ManCiNum(coneaig);j++){
-      assume[j+3] = toLitCond(offset + j , 0);
-    }
-    
-    
-    // 1:mean is unate
-    bool posUnate, negUnate;
-    vector<int> posUnate_vec, negUnate_vec, binate_vec;
-    // use to check sat status
-    int  status;
-    for(int indexinit=0; indexinit<=maxPiID; indexinit++){
-      if(Pinode[indexinit].initID != -1){
-        posUnate = true;
-        negUnate = true;
-        if(Pinode[indexinit].coneID != -1){
-          int index = Pinode[indexinit].coneID;
-          // each case set different assume
-          // cofactor let cnf->1, negcnf->0
-          assume[0] = toLitCond(cnfconeaig->pVarNums[index], 0);
-          assume[1] = toLitCond(negcnfconeaig->pVarNums[index], 1);
-          // close index enable, (1 mean set to 0)
-          assume[index + 2] = toLitCond(offset + index - 1, 1);
-          //pos-unate: F(~x)->F(x) so can't (F(~x) and ~F(x)) so set F(~x) = 1 and F(x) = 0
-          assume[2] = toLitCond(offset+Aig_ManCiNum(coneaig), 0);
-          status = sat_solver_solve(pSat, assume, assume+Cinum+3, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0);
-          posUnate = (status == l_False) ;
-          //neg-unate: F(x)->F(~x) so can't (~F(~x) and F(x)) so set F(~x) = 0 and F(x) = 1
-          //assume[2] = toLitCond(offset+Aig_ManCiNum(coneaig)+1, 0);
-          assume[0] = toLitCond(cnfconeaig->pVarNums[index], 1);
-          assume[1] = toLitCond(negcnfconeaig->pVarNums[index], 0);
-          status = sat_solver_solve(pSat, assume, assume+Cinum+3, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0);
-          negUnate = (status == l_False) ;
-          //reset enable
-          assume[index + 2] = toLitCond(offset + index - 1, 0);
-          if(isComplment){
-            bool trash = posUnate;
-            posUnate = negUnate;
-            negUnate = trash;
-          }
-        }
-        if(posUnate || negUnate){
-          if(posUnate) posUnate_vec.push_back(indexinit);
-          if(negUnate) negUnate_vec.push_back(indexinit);
-        }
-        else{//mean all false
-          binate_vec.push_back(indexinit);
-        }
+extern "C" Vec_Wec_t * Gia_ManCheckUnateVec( Gia_Man_t * p, Vec_Int_t * vCiIds, Vec_Int_t * vCoIds );
+
+// structural unateness, linear in the AIG size times the support: proved[co*nCis+ci] gets 2
+// when the CI reaches the CO only through even numbers of complemented edges (pos-unate)
+// and 1 when only through odd numbers (neg-unate)
+static void Lsv_PoUnateStructural(Gia_Man_t* pGia, vector<char>& proved){
+  Vec_Wec_t* vUnates = Gia_ManCheckUnateVec(pGia, NULL, NULL);
+  Vec_Int_t* vUnate;
+  int nCis = Gia_ManCiNum(pGia);
+  int o, k, Lit;
+  proved.assign(Gia_ManCoNum(pGia)*nCis, 0);
+  Vec_WecForEachLevel(vUnates, vUnate, o){
+    Vec_IntForEachEntry(vUnate, Lit, k){
+      //both literals of a CI are next to each other, it can be binate
+      if(k+1 < Vec_IntSize(vUnate) && Abc_Lit2Var(Lit) == Abc_Lit2Var(Vec_IntEntry(vUnate, k+1))){
+        k++;
+        continue;
       }
+      proved[o*nCis+Abc_Lit2Var(Lit)] = Abc_LitIsCompl(Lit) ? 1 : 2;
     }
-    //then we have posUnate_vec, negUnate_vec, binate_vec to print
-    //print
-    if(posUnate_vec.size()>0){
-      cout<<"+unate inputs: ";
-      for(int j=0;j<posUnate_vec.size();j++){
-        cout<<Pinode[posUnate_vec[j]].name;
-        if(j!=(posUnate_vec.size()-1))cout<<',';
-        else cout<<endl;
+  }
+  Vec_WecFree(vUnates);
+}
+
+// bit-parallel simulation under paired cofactors: for every CI x the same random
+// patterns are simulated with x=0 and x=1, witness[co*nCis+ci] gets bit 1 when
+// some pattern has F(x=0)=0,F(x=1)=1 (F is not neg-unate in x) and bit 2 when
+// some pattern has F(x=0)=1,F(x=1)=0 (F is not pos-unate in x), with a care CO
+// only the patterns where it is 1 under both cofactors count
+static void Lsv_PoUnateSimulate(Gia_Man_t* pGia, int nWords, int iCareCo, vector<char>& witness){
+  Gia_Obj_t* pObj;
+  int nCis = Gia_ManCiNum(pGia);
+  int i, k, w;
+  witness.assign(Gia_ManCoNum(pGia)*nCis, 0);
+  Abc_RandomW(1);
+  Vec_WrdFreeP(&pGia->vSimsPi);
+  pGia->vSimsPi = Vec_WrdStartRandom(nCis*nWords);
+  vector<word> saved(nWords), care(nWords);
+  for(i=0;i<nCis;i++){
+    word* pSimCi = Vec_WrdEntryP(pGia->vSimsPi, i*nWords);
+    memcpy(&saved[0], pSimCi, sizeof(word)*nWords);
+    memset(pSimCi, 0x00, sizeof(word)*nWords);
+    Vec_Wrd_t* vSims0 = Gia_ManSimPatSim(pGia);
+    memset(pSimCi, 0xFF, sizeof(word)*nWords);
+    Vec_Wrd_t* vSims1 = Gia_ManSimPatSim(pGia);
+    memcpy(pSimCi, &saved[0], sizeof(word)*nWords);
+    for(w=0;w<nWords;w++) care[w] = ~(word)0;
+    if(iCareCo >= 0){
+      int iCare = Gia_ObjId(pGia, Gia_ManCo(pGia, iCareCo));
+      word* pCare0 = Vec_WrdEntryP(vSims0, iCare*nWords);
+      word* pCare1 = Vec_WrdEntryP(vSims1, iCare*nWords);
+      for(w=0;w<nWords;w++) care[w] = pCare0[w] & pCare1[w];
+    }
+    Gia_ManForEachCo(pGia, pObj, k){
+      word* pSim0 = Vec_WrdEntryP(vSims0, Gia_ObjId(pGia,pObj)*nWords);
+      word* pSim1 = Vec_WrdEntryP(vSims1, Gia_ObjId(pGia,pObj)*nWords);
+      char& flags = witness[k*nCis+i];
+      for(w=0; w<nWords && flags!=3; w++){
+        if(~pSim0[w] & pSim1[w] & care[w]) flags |= 1;
+        if(pSim0[w] & ~pSim1[w] & care[w]) flags |= 2;
       }
     }
-    if(negUnate_vec.size()>0){
-      cout<<"-unate inputs: ";
-      for(int j=0;j<negUnate_vec.size();j++){
-        cout<<Pinode[negUnate_vec[j]].name;
-        if(j!=(negUnate_vec.size()-1))cout<<',';
-        else cout<<endl;
+    Vec_WrdFree(vSims0);
+    Vec_WrdFree(vSims1);
+  }
+}
+
+// combines the structural proof and the simulation witnesses of one query, both in terms
+// of the PO, returns the polarities still to be solved (2 pos, 1 neg) and sets *pTypes
+// to the polarities already proved unate
+static int Lsv_PoUnateFilter(int proved, int simFlags, int* pTypes, unatestats& stats){
+  int need = 3 & ~proved & ~simFlags;
+  *pTypes = proved;
+  stats.nQueries++;
+  if(proved) stats.nStructUnate++;
+  if(simFlags == 3) stats.nSimBinate++;
+  if(need == 0) stats.nNoSolve++;
+  return need;
+}
+
+// exchanges the pos and neg bits, the cone of a complemented PO is ~F
+static inline int Lsv_UnateSwap(int types){
+  return ((types & 1) << 1) | ((types >> 1) & 1);
+}
+
+// the truth table of a CO over the leaves, a CO driven by a constant or a CI has no cut to compute
+static void Lsv_PoUnateCoTruth(Gia_Man_t* pGia, Gia_Obj_t* pCo, Vec_Int_t* vLeaves, word* pTruth){
+  Gia_Obj_t* pObj = Gia_ObjFanin0(pCo);
+  int nWords = pGia->nTtWords;
+  if(Gia_ObjIsAnd(pObj))
+    Abc_TtCopy(pTruth, Gia_ObjComputeTruthTableCut(pGia, pObj, vLeaves), nWords, 0);
+  else if(Gia_ObjIsCi(pObj))
+    Abc_TtIthVar(pTruth, Vec_IntFind(vLeaves, Gia_ObjId(pGia, pObj)), pGia->nTtVars);
+  else
+    Abc_TtClear(pTruth, nWords);
+  if(Gia_ObjFaninC0(pCo))
+    Abc_TtNot(pTruth, nWords);
+}
+
+// exact unateness of every CO with at most nTtVars support inputs from the cofactors of its
+// truth table, ttSupp[co] gets the support size of such a CO and -1 for the COs left to SAT,
+// the row of proved of a finished CO holds its final types, 3 for the CIs outside the support
+// with a care CO the leaves are the union of both supports and the cofactors are compared
+// only where the care set holds under both of them
+static void Lsv_PoUnateTruth(Gia_Man_t* pGia, int nTtVars, int iCareCo, vector<char>& proved, vector<int>& ttSupp){
+  Gia_Obj_t* pCo, * pLeaf;
+  int nCis = Gia_ManCiNum(pGia);
+  int i, k, nSupp, pIds[2];
+  if(proved.empty()) proved.assign(Gia_ManCoNum(pGia)*nCis, 0);
+  ttSupp.assign(Gia_ManCoNum(pGia), -1);
+  Vec_Int_t* vLeaves = Vec_IntAlloc(nTtVars);
+  Gia_ObjComputeTruthTableStart(pGia, nTtVars);
+  int nWords = pGia->nTtWords;
+  vector<word> func(nWords), care(nWords), mask(nWords), temp(nWords), cof0(nWords), cof1(nWords);
+  if(iCareCo >= 0) pIds[1] = Gia_ObjId(pGia, Gia_ManCo(pGia, iCareCo));
+  Gia_ManForEachCo(pGia, pCo, i){
+    pIds[0] = Gia_ObjId(pGia, pCo);
+    Gia_ManCollectCis(pGia, pIds, 1, vLeaves);
+    if((nSupp = Vec_IntSize(vLeaves)) > nTtVars) continue;
+    if(iCareCo >= 0){
+      Gia_ManCollectCis(pGia, pIds, 2, vLeaves);
+      if(Vec_IntSize(vLeaves) > nTtVars) continue;
+      Lsv_PoUnateCoTruth(pGia, Gia_ManCo(pGia, iCareCo), vLeaves, &care[0]);
+    }
+    Lsv_PoUnateCoTruth(pGia, pCo, vLeaves, &func[0]);
+    char* pRow = &proved[i*nCis];
+    memset(pRow, 3, nCis);
+    Gia_ManForEachObjVec(vLeaves, pGia, pLeaf, k){
+      Abc_TtCofactor0p(&cof0[0], &func[0], nWords, k);
+      Abc_TtCofactor1p(&cof1[0], &func[0], nWords, k);
+      //pos-unate when F(x=0) implies F(x=1), neg-unate when F(x=1) implies F(x=0)
+      if(iCareCo < 0){
+        pRow[Gia_ObjCioId(pLeaf)] = (Abc_TtImply(&cof0[0], &cof1[0], nWords) ? 2 : 0) | (Abc_TtImply(&cof1[0], &cof0[0], nWords) ? 1 : 0);
+        continue;
       }
+      //the same restricted to C(x=0) & C(x=1)
+      Abc_TtCofactor0p(&mask[0], &care[0], nWords, k);
+      Abc_TtCofactor1p(&temp[0], &care[0], nWords, k);
+      Abc_TtAnd(&mask[0], &mask[0], &temp[0], nWords, 0);
+      Abc_TtAnd(&temp[0], &cof0[0], &mask[0], nWords, 0);
+      int posUnate = Abc_TtImply(&temp[0], &cof1[0], nWords);
+      Abc_TtAnd(&temp[0], &cof1[0], &mask[0], nWords, 0);
+      int negUnate = Abc_TtImply(&temp[0], &cof0[0], nWords);
+      pRow[Gia_ObjCioId(pLeaf)] = (posUnate ? 2 : 0) | (negUnate ? 1 : 0);
     }
-    if(binate_vec.size()>0){
-      cout<<"binate inputs: ";
-      for(int j=0;j<binate_vec.size();j++){
-        cout<<Pinode[binate_vec[j]].name;
-        if(j!=(binate_vec.size()-1))cout<<',';
-        else cout<<endl;
+    ttSupp[i] = nSupp;
+  }
+  Gia_ObjComputeTruthTableStop(pGia);
+  Vec_IntFree(vLeaves);
+}
+
+// the types of a CO finished by the truth table, only its support counts as queries
+static void Lsv_PoUnateTruthTypes(const char* pRow, int nCis, int nSupp, vector<char>& types, unatestats& stats){
+  types.assign(pRow, pRow+nCis);
+  stats.nQueries    += nSupp;
+  stats.nTruthTable += nSupp;
+  stats.nNoSolve    += nSupp;
+}
+
+// runs the passes in front of SAT over the whole network, indexed by PO and PI index
+static void Lsv_PoUnatePreprocess(Gia_Man_t* pGia, unatepars* pPars, vector<char>& proved, vector<char>& witness, vector<int>& ttSupp){
+  if(pPars->fStructural) Lsv_PoUnateStructural(pGia, proved);
+  //unate without don't-cares is unate with them, the structural proofs hold for any care set
+  if(pPars->nSimWords > 0) Lsv_PoUnateSimulate(pGia, pPars->nSimWords, pPars->iCarePo, witness);
+  //last, it overwrites the rows of the COs it finishes
+  if(pPars->nTtVars > 0) Lsv_PoUnateTruth(pGia, pPars->nTtVars, pPars->iCarePo, proved, ttSupp);
+}
+
+static void Lsv_AddUnateStats(unatestats& stats, const unatestats& add){
+  stats.nQueries     += add.nQueries;
+  stats.nStructUnate += add.nStructUnate;
+  stats.nSimBinate   += add.nSimBinate;
+  stats.nTruthTable  += add.nTruthTable;
+  stats.nNoSolve     += add.nNoSolve;
+  stats.nSatSolves   += add.nSatSolves;
+  stats.nConflicts   += add.nConflicts;
+  stats.nPropagations += add.nPropagations;
+}
+
+static void Lsv_PrintUnateStats(const unatestats& stats){
+  printf("Queries = %d  truth table = %d  structurally unate = %d  binate by simulation = %d  settled without SAT = %d  solves = %d (of %d)\n",
+      stats.nQueries, stats.nTruthTable, stats.nStructUnate, stats.nSimBinate, stats.nNoSolve, stats.nSatSolves, 2*stats.nQueries);
+  printf("Conflicts = %ld  propagations = %ld\n", stats.nConflicts, stats.nPropagations);
+}
+
+static void Lsv_BenchAddUnate(const unatestats& stats){
+  Lsv_BenchSat.nSolves       += stats.nSatSolves;
+  Lsv_BenchSat.nConflicts    += stats.nConflicts;
+  Lsv_BenchSat.nPropagations += stats.nPropagations;
+}
+
+// PI indices sorted by their object IDs, the order of the printed names
+static void Lsv_PiOrderById(Abc_Ntk_t* pNtk, vector<int>& order){
+  int i, j;
+  order.resize(Abc_NtkPiNum(pNtk));
+  for(i=0;i<order.size();i++) order[i] = i;
+  for(i=1;i<order.size();i++){
+    for(j=i; j>0 && Abc_ObjId(Abc_NtkPi(pNtk,order[j]))<Abc_ObjId(Abc_NtkPi(pNtk,order[j-1])); --j){
+      int temp = order[j]; order[j] = order[j-1]; order[j-1] = temp;
+    }
+  }
+}
+
+// prints one line of names separated by commas, nothing if the list is empty
+static void Lsv_PrintUnateLine(const char* label, const vector<char*>& names){
+  if(names.empty()) return;
+  cout<<label;
+  for(int j=0;j<names.size();j++){
+    cout<<names[j];
+    if(j!=(names.size()-1))cout<<',';
+    else cout<<endl;
+  }
+}
+
+// prints the result of one PO, types[pi] as in pojob
+static void Lsv_PrintUnateTypes(Abc_Ntk_t* pNtk, int iPo, const vector<int>& order, const vector<char>& types, lsvjson* pJson){
+  vector<char*> posNames, negNames, binNames;
+  for(int k=0;k<order.size();k++){
+    char* name = Abc_ObjName(Abc_NtkPi(pNtk,order[k]));
+    if(types[order[k]] & 2) posNames.push_back(name);
+    if(types[order[k]] & 1) negNames.push_back(name);
+    if(types[order[k]] == 0) binNames.push_back(name);
+  }
+  if(pJson){
+    Lsv_JsonBegin(pJson);
+    Lsv_JsonStr(pJson, "node", Abc_ObjName(Abc_NtkPo(pNtk,iPo)));
+    Lsv_JsonStrArray(pJson, "pos", posNames);
+    Lsv_JsonStrArray(pJson, "neg", negNames);
+    Lsv_JsonStrArray(pJson, "binate", binNames);
+    Lsv_JsonEnd(pJson);
+    return;
+  }
+  cout<<"node "<<Abc_ObjName(Abc_NtkPo(pNtk,iPo))<<":\n";
+  Lsv_PrintUnateLine("+unate inputs: ", posNames);
+  Lsv_PrintUnateLine("-unate inputs: ", negNames);
+  Lsv_PrintUnateLine("binate inputs: ", binNames);
+}
+
+// the GIA of the network both engines work on, the PI and PO order is kept
+static Gia_Man_t* Lsv_PoUnateGia(Abc_Ntk_t* pNtk){
+  Abc_Ntk_t* pStrash = Abc_NtkIsStrash(pNtk) ? pNtk : Abc_NtkStrash(pNtk,0,1,0);
+  Aig_Man_t* pAig = Abc_NtkToDar(pStrash,0,0);
+  Gia_Man_t* pGia = Gia_ManFromAig(pAig);
+  Aig_ManStop(pAig);
+  if(pStrash != pNtk) Abc_NtkDelete(pStrash);
+  return pGia;
+}
+
+static void Lsv_ConeStart(lsvcone* p, Gia_Man_t* pGia, Cnf_Dat_t* pCnf, int iCareCo, const vector<int>& careSupp){
+  p->pGia = pGia;
+  p->pInc = Cnf_IncStart(pGia, pCnf);
+  p->iCareCo = iCareCo;
+  p->careSupp = careSupp;
+  p->pSat = (sat_solver*)Cnf_IncSolver(p->pInc);
+  p->enVar.assign(Gia_ManCiNum(pGia), -1);
+  p->enabled.clear();
+}
+
+static void Lsv_ConeStop(lsvcone* p){
+  Cnf_IncStop(p->pInc);
+  p->pInc = NULL;
+  p->pSat = NULL;
+  vector<int>().swap(p->enVar);
+  vector<int>().swap(p->enabled);
+  vector<int>().swap(p->careSupp);
+}
+
+// forgets the loaded objects and empties the solver, linear in what was loaded
+static void Lsv_ConeRestart(lsvcone* p){
+  for(int k=0;k<p->enabled.size();k++)
+    p->enVar[p->enabled[k]] = -1;
+  p->enabled.clear();
+  Cnf_IncRestart(p->pInc);
+}
+
+// loads the part of the TFI of the object that is not loaded yet in both copies,
+// returns the variables of copy 0 and copy 1
+static void Lsv_ConeLoad(lsvcone* p, int iObj, int* pVar0, int* pVar1){
+  *pVar0 = Cnf_IncLoadObj(p->pInc, iObj, 0);
+  *pVar1 = Cnf_IncLoadObj(p->pInc, iObj, 1);
+}
+
+// the enable of x == x' of a CI, -1 when the loaded clauses never reach the CI
+static int Lsv_ConeEnable(lsvcone* p, int ci){
+  if(p->enVar[ci] >= 0) return p->enVar[ci];
+  int iObj = Gia_ManCiIdToId(p->pGia, ci);
+  int iVar0 = Cnf_IncObjVar(p->pInc, iObj, 0), iVar1 = Cnf_IncObjVar(p->pInc, iObj, 1);
+  if(iVar0 < 0) return -1;
+  assert(iVar1 >= 0);
+  p->enVar[ci] = Cnf_IncAddVars(p->pInc, 1);
+  sat_solver_add_buffer_enable(p->pSat, iVar0, iVar1, p->enVar[ci], 0);
+  p->enabled.push_back(ci);
+  return p->enVar[ci];
+}
+
+// solves the queries of one CO for the CIs in supp, only its TFI is loaded into the solver
+static void Lsv_ConeSolveCo(lsvcone* p, int iCo, const vector<int>& supp, const char* pProved, const char* pWitness,
+                            vector<char>& types, unatestats& stats){
+  int coVar, coVar1;
+  Lsv_ConeLoad(p, Gia_ObjId(p->pGia, Gia_ManCo(p->pGia, iCo)), &coVar, &coVar1);
+  //0~3 are x, x', F, F(~x), 4~ are the enables of the support
+  //a CI the clauses never reach is structural support only, F does not depend on it
+  vector<lit> assume(4);
+  vector<int> place(supp.size(), -1);
+  ABC_INT64_T nConflicts = p->pSat->stats.conflicts, nPropagations = p->pSat->stats.propagations;
+  int k, j;
+  for(k=0;k<supp.size();k++){
+    int enVar = Lsv_ConeEnable(p, supp[k]);
+    if(enVar < 0) continue;
+    place[k] = assume.size();
+    assume.push_back(toLitCond(enVar, 0));
+  }
+  //the care set holds in both copies and the CIs only it depends on stay equal,
+  //both supports are sorted so the ones already enabled above are skipped in one pass
+  if(p->iCareCo >= 0){
+    int careVar, careVar1;
+    Lsv_ConeLoad(p, Gia_ObjId(p->pGia, Gia_ManCo(p->pGia, p->iCareCo)), &careVar, &careVar1);
+    assume.push_back(toLitCond(careVar, 0));
+    assume.push_back(toLitCond(careVar1, 0));
+    for(j=k=0;j<p->careSupp.size();j++){
+      int ci = p->careSupp[j];
+      while(k<supp.size() && supp[k]<ci) k++;
+      if(k<supp.size() && supp[k]==ci && place[k] >= 0) continue;
+      int enVar = Lsv_ConeEnable(p, ci);
+      if(enVar >= 0) assume.push_back(toLitCond(enVar, 0));
+    }
+  }
+  for(k=0;k<supp.size();k++){
+    int ci = supp[k];
+    if(place[k] < 0){
+      types[ci] = 3;
+      stats.nQueries++;
+      stats.nNoSolve++;
+      continue;
+    }
+    int known, need = Lsv_PoUnateFilter(pProved ? pProved[ci] : 0, pWitness ? pWitness[ci] : 0, &known, stats);
+    if(need == 0){
+      types[ci] = known;
+      continue;
+    }
+    int ciObj = Gia_ManCiIdToId(p->pGia, ci);
+    int ciVar = Cnf_IncObjVar(p->pInc, ciObj, 0), ciVar1 = Cnf_IncObjVar(p->pInc, ciObj, 1);
+    //close the enable of x, (1 mean set to 0)
+    assume[place[k]] = lit_neg(assume[place[k]]);
+    assume[0] = toLitCond(ciVar, 0);
+    assume[1] = toLitCond(ciVar1, 1);
+    //pos-unate: can't have x=1 with F=0 and x=0 with F=1
+    bool posUnate = false;
+    if(need & 2){
+      assume[2] = toLitCond(coVar, 1);
+      assume[3] = toLitCond(coVar1, 0);
+      int status = sat_solver_solve(p->pSat, &assume[0], &assume[0]+assume.size(), (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0);
+      posUnate = (status == l_False);
+      stats.nSatSolves++;
+    }
+    //neg-unate: can't have x=1 with F=1 and x=0 with F=0
+    bool negUnate = false;
+    if(need & 1){
+      assume[2] = toLitCond(coVar, 0);
+      assume[3] = toLitCond(coVar1, 1);
+      int status = sat_solver_solve(p->pSat, &assume[0], &assume[0]+assume.size(), (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0);
+      negUnate = (status == l_False);
+      stats.nSatSolves++;
+    }
+    assume[place[k]] = lit_neg(assume[place[k]]);
+    types[ci] = known | (posUnate ? 2 : 0) | (negUnate ? 1 : 0);
+  }
+  stats.nConflicts += (long)(p->pSat->stats.conflicts - nConflicts);
+  stats.nPropagations += (long)(p->pSat->stats.propagations - nPropagations);
+}
+
+// the support and the filters of one PO, Gia_ManCollectCis() uses the travIds so it stays
+// on the main thread, a PO finished by the truth table gets its types here and no support
+static void Lsv_PoUnatePrepare(Gia_Man_t* pGia, int iPo, Vec_Int_t* vSupp, const vector<char>& proved,
+                               const vector<char>& witness, const vector<int>& ttSupp, pojob* pJob){
+  Gia_Obj_t* pObj;
+  int nCis = Gia_ManCiNum(pGia);
+  int k, iObj = Gia_ObjId(pGia, Gia_ManCo(pGia, iPo));
+  pJob->iPo = iPo;
+  pJob->supp.clear();
+  memset(&pJob->stats, 0, sizeof(unatestats));
+  if(!ttSupp.empty() && ttSupp[iPo] >= 0){
+    Lsv_PoUnateTruthTypes(&proved[iPo*nCis], nCis, ttSupp[iPo], pJob->types, pJob->stats);
+    return;
+  }
+  Gia_ManCollectCis(pGia, &iObj, 1, vSupp);
+  Gia_ManForEachObjVec(vSupp, pGia, pObj, k)
+    pJob->supp.push_back(Gia_ObjCioId(pObj));
+  sort(pJob->supp.begin(), pJob->supp.end());
+  pJob->pProved = proved.empty() ? NULL : &proved[iPo*nCis];
+  pJob->pWitness = witness.empty() ? NULL : &witness[iPo*nCis];
+  pJob->types.assign(nCis, 3);
+}
+
+// the SAT part of one PO, touches only the job and the cone manager so it can run on a worker
+// thread, the per-cone engine empties the solver first and the incremental one keeps it
+static void Lsv_PoUnateSolve(pojob* pJob, lsvcone* pCone, int fRestart){
+  if(pJob->supp.empty()) return;
+  if(fRestart) Lsv_ConeRestart(pCone);
+  Lsv_ConeSolveCo(pCone, pJob->iPo, pJob->supp, pJob->pProved, pJob->pWitness, pJob->types, pJob->stats);
+}
+
+static void Lsv_PoUnateFree(pojob* pJob){
+  vector<char>().swap(pJob->types);
+  vector<int>().swap(pJob->supp);
+}
+
+#ifdef ABC_USE_PTHREADS
+
+#define LSV_THR_MAX 100
+struct lsvthdata{
+  pojob* pJob;     // the PO being solved, NULL with fWorking set stops the thread
+  lsvcone cone;    // the solver of this thread
+  int fWorking;
+};
+
+static void* Lsv_PoUnateWorkerThread(void* pArg){
+  lsvthdata* pThData = (lsvthdata*)pArg;
+  volatile int* pPlace = &pThData->fWorking;
+  while(1){
+    while(*pPlace == 0);
+    __sync_synchronize();
+    if(pThData->pJob == NULL){
+      pthread_exit(NULL);
+      return NULL;
+    }
+    Lsv_PoUnateSolve(pThData->pJob, &pThData->cone, 1);
+    __sync_synchronize();
+    pThData->fWorking = 0;
+  }
+  return NULL;
+}
+
+// the main thread collects the supports and hands the POs to idle workers, results are
+// printed strictly in PO order as soon as all earlier POs are done
+static void Lsv_NtkPoUnateThreads(Abc_Ntk_t* pNtk, Gia_Man_t* pGia, Cnf_Dat_t* pCnf, unatepars* pPars, const vector<char>& proved,
+                                  const vector<char>& witness, const vector<int>& ttSupp, const vector<int>& careSupp,
+                                  const vector<int>& order, unatestats& stats){
+  lsvthdata ThData[LSV_THR_MAX];
+  pthread_t WorkerThread[LSV_THR_MAX];
+  int nThreads = Abc_MinInt(pPars->nThreads, LSV_THR_MAX);
+  int nPos = Abc_NtkPoNum(pNtk);
+  int i, status, iNext = 0, iPrint = 0;
+  vector<pojob> jobs(nPos);
+  vector<char> done(nPos, 0);
+  Vec_Int_t* vSupp = Vec_IntAlloc(100);
+  for(i=0;i<nThreads;i++){
+    ThData[i].pJob = NULL;
+    ThData[i].fWorking = 0;
+    Lsv_ConeStart(&ThData[i].cone, pGia, pCnf, pPars->iCarePo, careSupp);
+    status = pthread_create(WorkerThread + i, NULL, Lsv_PoUnateWorkerThread, (void*)(ThData + i));  assert(status == 0);
+  }
+  while(iPrint < nPos){
+    for(i=0;i<nThreads;i++){
+      if(((volatile lsvthdata*)(ThData + i))->fWorking)
+        continue;
+      __sync_synchronize();
+      if(ThData[i].pJob != NULL){
+        done[ThData[i].pJob->iPo] = 1;
+        ThData[i].pJob = NULL;
       }
+      if(iNext == nPos)
+        continue;
+      Lsv_PoUnatePrepare(pGia, iNext, vSupp, proved, witness, ttSupp, &jobs[iNext]);
+      ThData[i].pJob = &jobs[iNext++];
+      __sync_synchronize();
+      ThData[i].fWorking = 1;
+    }
+    while(iPrint < nPos && done[iPrint]){
+      if(!pPars->fQuiet) Lsv_PrintUnateTypes(pNtk, iPrint, order, jobs[iPrint].types, pPars->pJson);
+      Lsv_AddUnateStats(stats, jobs[iPrint].stats);
+      Lsv_PoUnateFree(&jobs[iPrint++]);
     }
   }
+  // stop threads
+  for(i=0;i<nThreads;i++){
+    assert(!ThData[i].fWorking && ThData[i].pJob == NULL);
+    __sync_synchronize();
+    ThData[i].fWorking = 1;
+    status = pthread_join(WorkerThread[i], NULL);  assert(status == 0);
+    Lsv_ConeStop(&ThData[i].cone);
+  }
+  Vec_IntFree(vSupp);
+}
+
+#endif // pthreads are used
+
+// per-cone engine: every PO gets an empty solver and only its TFI is loaded
+// incremental engine (fIncremental): one solver for all POs, each PO loads only the
+// nodes earlier POs did not reach, so every (PO,PI) query is a set of assumptions on
+// the same dual-rail miter and learned clauses are kept
+void Lsv_NtkPrintpounate(Abc_Ntk_t* pNtk, unatepars* pPars) {
+  Gia_Man_t* pGia = Lsv_PoUnateGia(pNtk);
+  unatestats stats = {0};
+  //structural proofs, simulation witnesses and truth tables of the whole network
+  vector<char> proved, witness;
+  vector<int> ttSupp;
+  Lsv_PoUnatePreprocess(pGia, pPars, proved, witness, ttSupp);
+  //one CNF of 8-input cuts for all cones, the solvers load the parts they reach
+  Cnf_Dat_t* pCnf = (Cnf_Dat_t*)Mf_ManGenerateCnf(pGia, 8, 1, 0, 0, 0);
+  pGia->pData = NULL;
+  vector<int> order, careSupp;
+  Lsv_PiOrderById(pNtk, order);
+  if(pPars->iCarePo >= 0){
+    Vec_Int_t* vCare = Vec_IntAlloc(100);
+    Gia_Obj_t* pObj;
+    int k, iCare = Gia_ObjId(pGia, Gia_ManCo(pGia, pPars->iCarePo));
+    Gia_ManCollectCis(pGia, &iCare, 1, vCare);
+    Gia_ManForEachObjVec(vCare, pGia, pObj, k)
+      careSupp.push_back(Gia_ObjCioId(pObj));
+    sort(careSupp.begin(), careSupp.end());
+    Vec_IntFree(vCare);
+  }
+#ifdef ABC_USE_PTHREADS
+  if(pPars->nThreads > 1){
+    Lsv_NtkPoUnateThreads(pNtk, pGia, pCnf, pPars, proved, witness, ttSupp, careSupp, order, stats);
+    if(pPars->fVerbose && !pPars->fQuiet) Lsv_PrintUnateStats(stats);
+    if(!pPars->fQuiet) Lsv_BenchAddUnate(stats);
+    Cnf_DataFree(pCnf);
+    Gia_ManStop(pGia);
+    return;
+  }
+#endif
+  //for each PO do it
+  lsvcone cone;
+  Lsv_ConeStart(&cone, pGia, pCnf, pPars->iCarePo, careSupp);
+  Vec_Int_t* vSupp = Vec_IntAlloc(100);
+  pojob job;
+  for(int i=0;i<Abc_NtkPoNum(pNtk);i++){
+    Lsv_PoUnatePrepare(pGia, i, vSupp, proved, witness, ttSupp, &job);
+    Lsv_PoUnateSolve(&job, &cone, !pPars->fIncremental);
+    if(!pPars->fQuiet) Lsv_PrintUnateTypes(pNtk, i, order, job.types, pPars->pJson);
+    Lsv_AddUnateStats(stats, job.stats);
+    Lsv_PoUnateFree(&job);
+  }
+  if(pPars->fVerbose && !pPars->fQuiet){
+    if(pPars->fIncremental)
+      printf("Incremental: vars = %d  clauses = %d  loaded objects = %d (of %d)  conflicts = %ld  decisions = %ld  props = %ld\n",
+          sat_solver_nvars(cone.pSat), sat_solver_nclauses(cone.pSat), Cnf_IncLoadedNum(cone.pInc)/2, Gia_ManObjNum(pGia),
+          (long)cone.pSat->stats.conflicts, (long)cone.pSat->stats.decisions, (long)cone.pSat->stats.propagations);
+    Lsv_PrintUnateStats(stats);
+  }
+  if(!pPars->fQuiet) Lsv_BenchAddUnate(stats);
+  Vec_IntFree(vSupp);
+  Lsv_ConeStop(&cone);
+  Cnf_DataFree(pCnf);
+  Gia_ManStop(pGia);
 }
 
 int Lsv_CommandPrintpounate(Abc_Frame_t* pAbc, int argc, char** argv) {
   Abc_Ntk_t* pNtk = Abc_FrameReadNtk(pAbc);
   int c;
+  unatepars Pars = {0};
+  abctime clk;
   Extra_UtilGetoptReset();
-  while ((c = Extra_UtilGetopt(argc, argv, "h")) != EOF) {
+  Pars.nThreads = 1;
+  Pars.fStructural = 1;
+  Pars.nTtVars = 16;
+  Pars.iCarePo = -1;
+  char* pJsonFile = NULL, * pCareName = NULL;
+  while ((c = Extra_UtilGetopt(argc, argv, "SpTcjsibvh")) != EOF) {
     switch (c) {
+      case 'S':
+        if (globalUtilOptind >= argc) {
+          Abc_Print(-1, "Command line switch \"-S\" should be followed by an integer.\n");
+          goto usage;
+        }
+        Pars.nSimWords = atoi(argv[globalUtilOptind]);
+        globalUtilOptind++;
+        if (Pars.nSimWords < 0)
+          goto usage;
+        break;
+      case 'p':
+        if (globalUtilOptind >= argc) {
+          Abc_Print(-1, "Command line switch \"-p\" should be followed by an integer.\n");
+          goto usage;
+        }
+        Pars.nThreads = atoi(argv[globalUtilOptind]);
+        globalUtilOptind++;
+        if (Pars.nThreads < 1)
+          goto usage;
+        break;
+      case 'T':
+        if (globalUtilOptind >= argc) {
+          Abc_Print(-1, "Command line switch \"-T\" should be followed by an integer.\n");
+          goto usage;
+        }
+        Pars.nTtVars = atoi(argv[globalUtilOptind]);
+        globalUtilOptind++;
+        if (Pars.nTtVars < 0 || Pars.nTtVars > 16)
+          goto usage;
+        break;
+      case 'c':
+        if (globalUtilOptind >= argc) {
+          Abc_Print(-1, "Command line switch \"-c\" should be followed by a PO name or index.\n");
+          goto usage;
+        }
+        pCareName = argv[globalUtilOptind];
+        globalUtilOptind++;
+        break;
+      case 'j':
+        if (globalUtilOptind >= argc) {
+          Abc_Print(-1, "Command line switch \"-j\" should be followed by a file name.\n");
+          goto usage;
+        }
+        pJsonFile = argv[globalUtilOptind];
+        globalUtilOptind++;
+        break;
+      case 's':
+        Pars.fStructural ^= 1;
+        break;
+      case 'i':
+        Pars.fIncremental ^= 1;
+        break;
+      case 'b':
+        Pars.fCompare ^= 1;
+        break;
+      case 'v':
+        Pars.fVerbose ^= 1;
+        break;
       case 'h':
         goto usage;
       default:
@@ -238,12 +717,62 @@ int Lsv_CommandPrintpounate(Abc_Frame_t* pAbc, int argc, char** argv) {
     Abc_Print(-1, "Empty network.\n");
     return 1;
   }
-  Lsv_NtkPrintpounate(pNtk);
+  if (pCareName) {
+    Abc_Obj_t* pPo;
+    int i;
+    Abc_NtkForEachPo(pNtk, pPo, i)
+      if (!strcmp(Abc_ObjName(pPo), pCareName))
+        Pars.iCarePo = i;
+    if (Pars.iCarePo < 0 && pCareName[strspn(pCareName, "0123456789")] == 0)
+      Pars.iCarePo = atoi(pCareName);
+    if (Pars.iCarePo < 0 || Pars.iCarePo >= Abc_NtkPoNum(pNtk)) {
+      Abc_Print(-1, "Cannot find the care output \"%s\".\n", pCareName);
+      return 1;
+    }
+  }
+  if (Pars.fIncremental && Pars.nThreads > 1) {
+    Abc_Print(-1, "The incremental engine uses one solver, \"-p\" applies to the per-cone engine.\n");
+    return 1;
+  }
+  if (pJsonFile && (Pars.pJson = Lsv_JsonOpen(pJsonFile)) == NULL)
+    return 1;
+  // wall clock, the per-cone engine spends its time in the worker threads
+  clk = Abc_ClockWall();
+  Lsv_NtkPrintpounate(pNtk, &Pars);
+  clk = Abc_ClockWall() - clk;
+  if (Pars.pJson)
+    Lsv_JsonClose(Pars.pJson);
+  if (Pars.fCompare) {
+    // run the other engine silently for comparison
+    unatepars Other = Pars;
+    abctime clkOther;
+    Other.fIncremental ^= 1;
+    Other.nThreads = Other.fIncremental ? 1 : Pars.nThreads;
+    Other.pJson = NULL;
+    Other.fQuiet = 1;
+    clkOther = Abc_ClockWall();
+    Lsv_NtkPrintpounate(pNtk, &Other);
+    clkOther = Abc_ClockWall() - clkOther;
+    Abc_PrintTime(1, "Per-cone time   ", Pars.fIncremental ? clkOther : clk);
+    Abc_PrintTime(1, "Incremental time", Pars.fIncremental ? clk : clkOther);
+  }
+  else if (Pars.fVerbose)
+    Abc_PrintTime(1, Pars.fIncremental ? "Incremental time" : "Per-cone time   ", clk);
   return 0;
 
 usage:
-  Abc_Print(-2, "usage: lsv_print_pounateunate [-h]\n");
-  Abc_Print(-2, "\t        prints the nodes in the network\n");
+  Abc_Print(-2, "usage: lsv_print_pounate [-S num] [-p num] [-T num] [-c po] [-j file] [-sibvh]\n");
+  Abc_Print(-2, "\t        prints the unateness of each PO in terms of all PIs\n");
+  Abc_Print(-2, "\t-S num : 64-bit words of random simulation to find binate inputs before SAT, 0 = off [default = %d]\n", Pars.nSimWords);
+  Abc_Print(-2, "\t-p num : the number of worker threads of the per-cone engine [default = %d]\n", Pars.nThreads);
+  Abc_Print(-2, "\t-T num : outputs with at most this many inputs (0 <= num <= 16) use truth tables instead of SAT [default = %d]\n", Pars.nTtVars);
+  Abc_Print(-2, "\t-c po  : name or index of the PO whose onset is the care set, unateness is decided\n");
+  Abc_Print(-2, "\t         only where it is 1 under both cofactors [default = no don't-cares]\n");
+  Abc_Print(-2, "\t-j file: write the results to the file as JSON lines instead\n");
+  Abc_Print(-2, "\t-s    : toggle skipping the solves proved by structural unateness [default = %s]\n", Pars.fStructural ? "yes" : "no");
+  Abc_Print(-2, "\t-i    : toggle using one incremental solver for all outputs [default = %s]\n", Pars.fIncremental ? "yes" : "no");
+  Abc_Print(-2, "\t-b    : toggle also running the other engine and printing the wall-clock time of both [default = %s]\n", Pars.fCompare ? "yes" : "no");
+  Abc_Print(-2, "\t-v    : toggle printing solver statistics and the wall-clock time [default = %s]\n", Pars.fVerbose ? "yes" : "no");
   Abc_Print(-2, "\t-h    : print the command usage\n");
   return 1;
-}
\ No newline at end of file
+}
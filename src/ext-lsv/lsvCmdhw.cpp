@@ -1,8 +1,12 @@
 #include "base/abc/abc.h"
 #include "base/main/main.h"
 #include "base/main/mainInt.h"
+#include "ext-lsv/lsvJson.h"
 #include <iostream>
 #include <string.h>
+#include <string>
+#include <vector>
+#include <algorithm>
 using namespace std;
 
 static int Lsv_CommandPrintSOP(Abc_Frame_t* pAbc, int argc, char** argv);
@@ -31,152 +35,121 @@ struct inputnode{
   // 3: binate
 };
 
-void Lsv_NtkPrintSOP(Abc_Ntk_t* pNtk) {
+static bool Lsv_InputnodeLess(const inputnode& a, const inputnode& b){
+  return a.ID < b.ID;
+}
+
+// appends one line of names with the given type bits, nothing if no fanin matches
+static void Lsv_AppendSOPLine(string& out, const char* label, const vector<inputnode>& node, int mask, int type){
+  bool first = true;
+  for(int i=0; i<node.size(); ++i){
+    if((node[i].type & mask) != type) continue;
+    out += first ? label : ",";
+    out += node[i].name;
+    first = false;
+  }
+  if(!first) out += '\n';
+}
+
+// the same selection of names as Lsv_AppendSOPLine for the JSON output
+static void Lsv_CollectSOPNames(vector<char*>& names, const vector<inputnode>& node, int mask, int type){
+  names.clear();
+  for(int i=0; i<node.size(); ++i)
+    if((node[i].type & mask) == type) names.push_back(node[i].name);
+}
+
+// the literal masks of the cover are OR-reduced over all cubes 8 columns at a time:
+// '0' and '1' have bit 4 set and '-' does not, bit 0 tells '1' from '0', so byte v
+// of pos/neg ends up non-zero when some cube has literal v/~v
+// pJson != NULL writes one JSON line per node instead of the text
+void Lsv_NtkPrintSOP(Abc_Ntk_t* pNtk, lsvjson* pJson) {
+  if (!Abc_NtkHasSop(pNtk)) return;
+  const word ones = ABC_CONST(0x0101010101010101);
   Abc_Obj_t* pObj;
   int i;
+  vector<word> pos, neg;
+  vector<inputnode> node;
+  vector<char*> names;
+  string out;
   Abc_NtkForEachNode(pNtk, pObj, i) {
-    
-    Abc_Obj_t* pFanin;
-    int j;
-    //get input
-    Abc_ObjForEachFanin(pObj, pFanin, j) {
-      //printf("Fanin-%d: Id = %d, name = %s\n", j, Abc_ObjId(pFanin),Abc_ObjName(pFanin)); //return char*
+    char* SOP = (char*)pObj->pData;
+    int nFanins = Abc_ObjFaninNum(pObj);
+    if(nFanins == 0) continue; //const node
+    int nWords = (nFanins + 7) / 8;
+    int nFull = nFanins / 8;
+    pos.assign(nWords, 0);
+    neg.assign(nWords, 0);
+    char* pCube;
+    int k, v;
+    Abc_SopForEachCube(SOP, nFanins, pCube){
+      for(k=0; k<nFull; k++){
+        word x;
+        memcpy(&x, pCube + 8*k, sizeof(word));
+        word lit = (x >> 4) & ones;
+        pos[k] |= lit & x;
+        neg[k] |= lit & ~x;
+      }
+      //the last columns one by one, a full word could read past the end of the cover
+      for(v=8*nFull; v<nFanins; v++){
+        if(pCube[v] == '1') pos[k] |= (word)1 << (8*(v&7));
+        else if(pCube[v] == '0') neg[k] |= (word)1 << (8*(v&7));
+      }
     }
-    inputnode node[j];
-    Abc_ObjForEachFanin(pObj, pFanin, j) {
-      node[j].ID = Abc_ObjId(pFanin);
-      node[j].name = Abc_ObjName(pFanin);
-      node[j].type = 0;
+    //the offset cover has the types of the onset exchanged
+    bool positiveSOP = !Abc_SopIsComplement(SOP);
+    node.resize(nFanins);
+    Abc_Obj_t* pFanin;
+    Abc_ObjForEachFanin(pObj, pFanin, v) {
+      int anyPos = (int)(pos[v/8] >> (8*(v&7))) & 1;
+      int anyNeg = (int)(neg[v/8] >> (8*(v&7))) & 1;
+      node[v].ID = Abc_ObjId(pFanin);
+      node[v].name = Abc_ObjName(pFanin);
+      node[v].type = (anyPos ? (positiveSOP ? 1 : 2) : 0) | (anyNeg ? (positiveSOP ? 2 : 1) : 0);
     }
-    //get SOP
-    char* SOP = NULL;
-    bool positiveSOP = false;
-    int SOPline = 0;
-    if (Abc_NtkHasSop(pNtk)) {
-      SOP = (char*)pObj->pData;
+    sort(node.begin(), node.end(), Lsv_InputnodeLess);
+    if(pJson){
+      Lsv_JsonBegin(pJson);
+      Lsv_JsonStr(pJson, "node", Abc_ObjName(pObj));
+      Lsv_CollectSOPNames(names, node, 2, 0);
+      Lsv_JsonStrArray(pJson, "pos", names);
+      Lsv_CollectSOPNames(names, node, 1, 0);
+      Lsv_JsonStrArray(pJson, "neg", names);
+      Lsv_CollectSOPNames(names, node, 3, 3);
+      Lsv_JsonStrArray(pJson, "binate", names);
+      Lsv_JsonEnd(pJson);
+      continue;
     }
-    //printf("SOP:\n%s",SOP);
-    if(SOP!=NULL && strlen(SOP)>3){ //mean didn't have SOP or not const
-      //cout<<strlen(SOP)<<endl;
-      printf("node %s:\n", Abc_ObjName(pObj));
-      //get information
-      if(SOP[j+1]=='1')positiveSOP = true;
-      SOPline = strlen(SOP)/(j+3);
-      //operate 
-      for(int word=0; word<j; ++word){
-        for(int loop=0; loop<SOPline; ++loop){
-          int index = word+loop*(j+3);
-          if(node[word].type==0){
-            if(SOP[index]=='1'){node[word].type=1;}
-            else if(SOP[index]=='0'){node[word].type=2;}
-            else if(SOP[index]=='-'){}
-            else cerr<<"error SOP"<<endl;
-          }
-          else if(node[word].type==1){
-            if(SOP[index]=='1'){node[word].type=1;}
-            else if(SOP[index]=='0'){node[word].type=3;}
-            else if(SOP[index]=='-'){}
-            else cerr<<"error SOP"<<endl;
-          }
-          else if(node[word].type==2){
-            if(SOP[index]=='1'){node[word].type=3;}
-            else if(SOP[index]=='0'){node[word].type=2;}
-            else if(SOP[index]=='-'){}
-            else cerr<<"error SOP"<<endl;
-          }
-          else if(node[word].type==3){
-            if(SOP[index]=='1'){node[word].type=3;}
-            else if(SOP[index]=='0'){node[word].type=3;}
-            else if(SOP[index]=='-'){node[word].type=3;}
-            else cerr<<"error SOP"<<endl;
-          }
-          else{
-            cerr<<"error node type"<<endl;
-          }
-        }
-      }
-      //check negative
-      if(positiveSOP == false){
-        for(int i=0; i<j; ++i){
-          if(node[i].type==1)node[i].type=2;
-          else if(node[i].type==2)node[i].type=1;
-        }
-      }
-      //insertion sort
-      for(int i=1;i<j;i++){
-        for(int index = i; index>0; --index){
-          if(node[index].ID < node[index-1].ID){//need change
-            inputnode temp;
-            temp.ID = node[index].ID;
-            temp.name = node[index].name;
-            temp.type = node[index].type;
-            node[index].ID = node[index-1].ID;
-            node[index].name = node[index-1].name;
-            node[index].type = node[index-1].type;
-            node[index-1].ID = temp.ID;
-            node[index-1].name = temp.name;
-            node[index-1].type = temp.type;
-          }
-          else break;
-        }
-      }
-      //count each type number
-      int pos_unate = 0;
-      int neg_unate = 0;
-      int bi_unate = 0;
-      for(int i=0; i<j; ++i){
-        if(node[i].type==0){++pos_unate; ++neg_unate;}
-        else if(node[i].type==1)++pos_unate;
-        else if(node[i].type==2)++neg_unate;
-        else if(node[i].type==3)++bi_unate;
-      }
-      //output
-      int checkcount=0;
-      if(pos_unate>0){
-        printf("+unate inputs: ");
-        for(int i=0; i<j; ++i){
-          if(node[i].type==0 || node[i].type==1){
-            ++checkcount;
-            cout<<node[i].name;//<<'('<<node[i].ID<<")";
-            if(checkcount!=pos_unate)cout<<',';
-          }
-        }
-        cout<<endl;
-      }
-      checkcount=0;
-      if(neg_unate>0){
-        printf("-unate inputs: ");
-        for(int i=0; i<j; ++i){
-          if(node[i].type==0 || node[i].type==2){
-            ++checkcount;
-            cout<<node[i].name;//<<'('<<node[i].ID<<")";
-            if(checkcount!=neg_unate)cout<<',';
-          }
-        }
-        cout<<endl;
-      }
-      checkcount=0;
-      if(bi_unate>0){
-        printf("binate inputs: ");
-        for(int i=0; i<j; ++i){
-          if(node[i].type==3){
-            ++checkcount;
-            cout<<node[i].name;//<<'('<<node[i].ID<<")";
-            if(checkcount!=bi_unate)cout<<',';
-          }
-        }
-        cout<<endl;
-      }
+    //output, type 0 is both pos and neg unate
+    out += "node ";
+    out += Abc_ObjName(pObj);
+    out += ":\n";
+    Lsv_AppendSOPLine(out, "+unate inputs: ", node, 2, 0);
+    Lsv_AppendSOPLine(out, "-unate inputs: ", node, 1, 0);
+    Lsv_AppendSOPLine(out, "binate inputs: ", node, 3, 3);
+    if(out.size() > (1<<20)){
+      fwrite(out.data(), 1, out.size(), stdout);
+      out.clear();
     }
   }
+  fwrite(out.data(), 1, out.size(), stdout);
+  fflush(stdout);
 }
 
 int Lsv_CommandPrintSOP(Abc_Frame_t* pAbc, int argc, char** argv) {
   Abc_Ntk_t* pNtk = Abc_FrameReadNtk(pAbc);
   int c;
+  char* pJsonFile = NULL;
   Extra_UtilGetoptReset();
-  while ((c = Extra_UtilGetopt(argc, argv, "h")) != EOF) {
+  while ((c = Extra_UtilGetopt(argc, argv, "jh")) != EOF) {
     switch (c) {
+      case 'j':
+        if (globalUtilOptind >= argc) {
+          Abc_Print(-1, "Command line switch \"-j\" should be followed by a file name.\n");
+          goto usage;
+        }
+        pJsonFile = argv[globalUtilOptind];
+        globalUtilOptind++;
+        break;
       case 'h':
         goto usage;
       default:
@@ -187,12 +160,21 @@ int Lsv_CommandPrintSOP(Abc_Frame_t* pAbc, int argc, char** argv) {
     Abc_Print(-1, "Empty network.\n");
     return 1;
   }
-  Lsv_NtkPrintSOP(pNtk);
+  if (pJsonFile) {
+    lsvjson* pJson = Lsv_JsonOpen(pJsonFile);
+    if (pJson == NULL)
+      return 1;
+    Lsv_NtkPrintSOP(pNtk, pJson);
+    Lsv_JsonClose(pJson);
+    return 0;
+  }
+  Lsv_NtkPrintSOP(pNtk, NULL);
   return 0;
 
 usage:
-  Abc_Print(-2, "usage: lsv_print_sopunate [-h]\n");
-  Abc_Print(-2, "\t        prints the nodes in the network\n");
+  Abc_Print(-2, "usage: lsv_print_sopunate [-j file] [-h]\n");
+  Abc_Print(-2, "\t        prints the unateness of each node in terms of its fanins\n");
+  Abc_Print(-2, "\t-j file: write the results to the file as JSON lines instead\n");
   Abc_Print(-2, "\t-h    : print the command usage\n");
   return 1;
 }
\ No newline at end of file
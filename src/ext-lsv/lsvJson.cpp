@@ -0,0 +1,98 @@
+#include "base/abc/abc.h"
+#include "ext-lsv/lsvJson.h"
+using namespace std;
+
+// the buffer is written out when it grows past this size
+#define LSV_JSON_BUF (1<<20)
+
+lsvjson* Lsv_JsonOpen(const char* pFileName){
+  FILE* pFile = fopen(pFileName, "wb");
+  if(pFile == NULL){
+    Abc_Print(-1, "Cannot open file \"%s\" for writing.\n", pFileName);
+    return NULL;
+  }
+  lsvjson* p = new lsvjson;
+  p->pFile = pFile;
+  p->buf.reserve(LSV_JSON_BUF + 4096);
+  p->fFirst = true;
+  return p;
+}
+
+void Lsv_JsonClose(lsvjson* p){
+  fwrite(p->buf.data(), 1, p->buf.size(), p->pFile);
+  fclose(p->pFile);
+  delete p;
+}
+
+void Lsv_JsonBegin(lsvjson* p){
+  p->buf += '{';
+  p->fFirst = true;
+}
+
+void Lsv_JsonEnd(lsvjson* p){
+  p->buf += "}\n";
+  if(p->buf.size() > LSV_JSON_BUF){
+    fwrite(p->buf.data(), 1, p->buf.size(), p->pFile);
+    p->buf.clear();
+  }
+}
+
+// quotes and escapes a string, names may contain anything
+static void Lsv_JsonQuote(string& buf, const char* pStr){
+  buf += '"';
+  for(const char* c = pStr; *c; c++){
+    if(*c == '"' || *c == '\\'){
+      buf += '\\';
+      buf += *c;
+    }
+    else if(*c == '\n') buf += "\\n";
+    else if((unsigned char)*c < 0x20){
+      char temp[8];
+      snprintf(temp, sizeof(temp), "\\u%04x", (unsigned char)*c);
+      buf += temp;
+    }
+    else buf += *c;
+  }
+  buf += '"';
+}
+
+static void Lsv_JsonKey(lsvjson* p, const char* pKey){
+  if(!p->fFirst) p->buf += ',';
+  p->fFirst = false;
+  Lsv_JsonQuote(p->buf, pKey);
+  p->buf += ':';
+}
+
+void Lsv_JsonInt(lsvjson* p, const char* pKey, int Value){
+  char temp[16];
+  Lsv_JsonKey(p, pKey);
+  snprintf(temp, sizeof(temp), "%d", Value);
+  p->buf += temp;
+}
+
+void Lsv_JsonStr(lsvjson* p, const char* pKey, const char* pValue){
+  Lsv_JsonKey(p, pKey);
+  Lsv_JsonQuote(p->buf, pValue);
+}
+
+void Lsv_JsonStrArray(lsvjson* p, const char* pKey, const vector<char*>& values){
+  Lsv_JsonKey(p, pKey);
+  p->buf += '[';
+  for(int i=0; i<values.size(); i++){
+    if(i) p->buf += ',';
+    Lsv_JsonQuote(p->buf, values[i]);
+  }
+  p->buf += ']';
+}
+
+void Lsv_JsonIntArray(lsvjson* p, const char* pKey, const vector<int>& values){
+  char temp[16];
+  Lsv_JsonKey(p, pKey);
+  p->buf += '[';
+  for(int i=0; i<values.size(); i++){
+    if(i) p->buf += ',';
+    snprintf(temp, sizeof(temp), "%d", values[i]);
+    p->buf += temp;
+  }
+  p->buf += ']';
+}
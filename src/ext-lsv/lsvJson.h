@@ -0,0 +1,25 @@
+#ifndef LSV_JSON_H
+#define LSV_JSON_H
+
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+// JSON-lines output of the LSV commands, one object per line collected in a
+// large buffer and written with fwrite, so no per-item flushing through iostream
+struct lsvjson{
+  FILE* pFile;
+  std::string buf;
+  bool fFirst;      // no key written yet in the current object
+};
+
+extern lsvjson* Lsv_JsonOpen(const char* pFileName);
+extern void     Lsv_JsonClose(lsvjson* p);
+extern void     Lsv_JsonBegin(lsvjson* p);
+extern void     Lsv_JsonEnd(lsvjson* p);
+extern void     Lsv_JsonInt(lsvjson* p, const char* pKey, int Value);
+extern void     Lsv_JsonStr(lsvjson* p, const char* pKey, const char* pValue);
+extern void     Lsv_JsonStrArray(lsvjson* p, const char* pKey, const std::vector<char*>& values);
+extern void     Lsv_JsonIntArray(lsvjson* p, const char* pKey, const std::vector<int>& values);
+
+#endif
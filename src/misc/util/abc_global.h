@@ -339,6 +339,21 @@ static inline abctime Abc_Clock()
 #endif
 }
 
+// the wall-clock time, which unlike Abc_Clock() includes the time of other threads
+static inline abctime Abc_ClockWall()
+{
+#if (defined(LIN) || defined(LIN64)) && !(__APPLE__ & __MACH__) && !defined(__MINGW32__)
+    struct timespec ts;
+    if ( clock_gettime(CLOCK_MONOTONIC, &ts) < 0 ) 
+        return (abctime)-1;
+    abctime res = ((abctime) ts.tv_sec) * CLOCKS_PER_SEC;
+    res += (((abctime) ts.tv_nsec) * CLOCKS_PER_SEC) / 1000000000;
+    return res;
+#else
+    return Abc_Clock();
+#endif
+}
+
 
 // misc printing procedures
 enum Abc_VerbLevel
@@ -64,6 +64,7 @@ struct Cec_ParSim_t_
     int              nRounds;       // the number of simulation rounds
     int              nNonRefines;   // the max number of rounds without refinement
     int              TimeLimit;     // the runtime limit in seconds
+    int              nThreads;      // the number of simulation threads
     int              fDualOut;      // miter with separate outputs
     int              fCheckMiter;   // the circuit is the miter
 //    int              fFirstStop;    // stop on the first sat output
@@ -106,6 +107,7 @@ struct Cec_ParFra_t_
     int              nCallsRecycle; // calls to perform before recycling SAT solver
     int              nSatVarMax;    // the max number of SAT variables
     int              nGenIters;     // pattern generation iterations
+    int              nProcs;        // the number of threads of simulation and SAT sweeping
     int              fRewriting;    // enables AIG rewriting
     int              fCheckMiter;   // the circuit is the miter
 //    int              fFirstStop;    // stop on the first sat output
@@ -147,6 +149,7 @@ struct Cec_ParCor_t_
     int              nBTLimit;      // conflict limit at a node
     int              nLevelMax;     // (scorr only) the max number of levels
     int              nStepsMax;     // (scorr only) the max number of induction steps
+    int              nProcs;        // the number of simulation threads
     int              fLatchCorr;    // consider only latch outputs
     int              fConstCorr;    // consider only constants
     int              fUseRings;     // use rings
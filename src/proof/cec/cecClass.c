@@ -32,6 +32,15 @@ static inline void       Cec_ObjSetSim( Cec_ManSim_t * p, int Id, int n )  { p->
 
 static inline float      Cec_MemUsage( Cec_ManSim_t * p )                  { return 1.0*p->nMemsMax*(p->pPars->nWords+1)/(1<<20);   }
 
+typedef struct Cec_ManSimThData_t_ Cec_ManSimThData_t;
+struct Cec_ManSimThData_t_
+{
+    Cec_ManSim_t *   p;              // simulation manager
+    Vec_Ptr_t *      vInfoCos;       // CO simulation info
+    int              wStart;         // the first word of this thread
+    int              wStop;          // the word after the last word of this thread
+};
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -498,8 +507,9 @@ void Cec_ManSimProcessRefined( Cec_ManSim_t * p, Vec_Int_t * vRefined )
         if ( Gia_ObjIsHead( p->pAig, i ) )
             Cec_ManSimClassRefineOne( p, i );
     }
-    Vec_IntForEachEntry( vRefined, i, k )
-        Cec_ManSimSimDeref( p, i );
+    if ( !p->fSimsAll )
+        Vec_IntForEachEntry( vRefined, i, k )
+            Cec_ManSimSimDeref( p, i );
     ABC_FREE( pTable );
 }
 
@@ -638,6 +648,140 @@ int Cec_ManSimAnalyzeOutputs( Cec_ManSim_t * p )
     return p->pCexes != NULL;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Simulates one range of words for all internal nodes and COs.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Cec_ManSimSimulateThread( void * pArg )
+{
+    Cec_ManSimThData_t * pThData = (Cec_ManSimThData_t *)pArg;
+    Cec_ManSim_t * p = pThData->p;
+    Gia_Obj_t * pObj;
+    unsigned * pRes0, * pRes1, * pRes;
+    int i, w, iCoId = 0;
+    Gia_ManForEachObj1( p->pAig, pObj, i )
+    {
+        if ( Gia_ObjIsCi(pObj) )
+            continue;
+        if ( Gia_ObjIsCo(pObj) )
+        {
+            if ( pThData->vInfoCos == NULL )
+                continue;
+            pRes0 = Cec_ObjSim( p, Gia_ObjFaninId0(pObj,i) );
+            pRes  = (unsigned *)Vec_PtrEntry( pThData->vInfoCos, iCoId++ );
+            if ( Gia_ObjFaninC0(pObj) )
+                for ( w = pThData->wStart; w < pThData->wStop; w++ )
+                    pRes[w] = ~pRes0[w];
+            else 
+                for ( w = pThData->wStart; w < pThData->wStop; w++ )
+                    pRes[w] = pRes0[w];
+            continue;
+        }
+        pRes  = Cec_ObjSim( p, i );
+        pRes0 = Cec_ObjSim( p, Gia_ObjFaninId0(pObj,i) );
+        pRes1 = Cec_ObjSim( p, Gia_ObjFaninId1(pObj,i) );
+        if ( Gia_ObjFaninC0(pObj) )
+        {
+            if ( Gia_ObjFaninC1(pObj) )
+                for ( w = pThData->wStart; w < pThData->wStop; w++ )
+                    pRes[w] = ~(pRes0[w] | pRes1[w]);
+            else
+                for ( w = pThData->wStart; w < pThData->wStop; w++ )
+                    pRes[w] = ~pRes0[w] & pRes1[w];
+        }
+        else
+        {
+            if ( Gia_ObjFaninC1(pObj) )
+                for ( w = pThData->wStart; w < pThData->wStop; w++ )
+                    pRes[w] = pRes0[w] & ~pRes1[w];
+            else
+                for ( w = pThData->wStart; w < pThData->wStop; w++ )
+                    pRes[w] = pRes0[w] & pRes1[w];
+        }
+    }
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates one round using several threads.]
+
+  Description [Returns 0 if the round should be simulated serially.
+  Otherwise, every object gets its own simulation info, instead of the
+  reference-counted memory. The threads simulate the AIG on their own
+  ranges of words, then the classes are refined serially using all
+  words, in the same order as in the serial round. The random CI 
+  patterns are generated serially, so the results do not depend on 
+  the number of threads.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cec_ManSimSimulatePar( Cec_ManSim_t * p, Vec_Ptr_t * vInfoCis, Vec_Ptr_t * vInfoCos )
+{
+    Cec_ManSimThData_t ThData[GIA_SIM_THR_MAX];
+    Gia_Obj_t * pObj;
+    unsigned * pRes;
+    int i, w, nObjs = Gia_ManObjNum(p->pAig);
+    int nThreads = Gia_ManSimShardNum( p->nWords, p->pPars->nThreads, 16 );
+    if ( nThreads == 1 || (word)nObjs * (p->nWords + 1) > (word)0x7FFFFFFF )
+        return 0;
+    assert( !p->fSimsAll );
+    p->fSimsAll = 1;
+    p->pMems = ABC_ALLOC( unsigned, (size_t)nObjs * (p->nWords + 1) );
+    for ( i = 0; i < nObjs; i++ )
+        p->pSimInfo[i] = i * (p->nWords + 1);
+    p->nMemsMax = nObjs;
+    memset( Cec_ObjSim(p, 0), 0, sizeof(unsigned) * p->nWords );
+    // assign the CIs
+    Gia_ManForEachCi( p->pAig, pObj, i )
+    {
+        if ( Gia_ObjValue(pObj) == 0 )
+            continue;
+        pRes = Cec_ObjSim( p, Gia_ObjId(p->pAig, pObj) );
+        if ( vInfoCis ) 
+            memcpy( pRes, Vec_PtrEntry(vInfoCis, i), sizeof(unsigned) * p->nWords );
+        else
+            for ( w = 0; w < p->nWords; w++ )
+                pRes[w] = Gia_ManRandom( 0 );
+        // make sure the first pattern is always zero
+        pRes[0] ^= (pRes[0] & 1);
+    }
+    // simulate the nodes
+    for ( i = 0; i < nThreads; i++ )
+    {
+        ThData[i].p        = p;
+        ThData[i].vInfoCos = vInfoCos;
+        Gia_ManSimShardRange( p->nWords, nThreads, 16, i, &ThData[i].wStart, &ThData[i].wStop );
+    }
+    Gia_ManSimRunThreads( Cec_ManSimSimulateThread, ThData, sizeof(Cec_ManSimThData_t), nThreads );
+    // refine the classes
+    Gia_ManForEachObj1( p->pAig, pObj, i )
+    {
+        if ( Gia_ObjIsCo(pObj) || Gia_ObjValue(pObj) == 0 )
+            continue;
+        pRes = Cec_ObjSim( p, i );
+        if ( Gia_ObjIsConst(p->pAig, i) && !Cec_ManSimCompareConst(pRes, p->nWords) )
+        {
+            Vec_IntPush( p->vRefinedC, i );
+            if ( p->pBestState )
+                Cec_ManSimCompareConstScore( pRes, p->nWords, p->pScores );
+        }
+        if ( Gia_ObjIsTail(p->pAig, i) )
+            Cec_ManSimClassRefineOne( p, Gia_ObjRepr(p->pAig, i) );
+    }
+    return 1;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Simulates one round.]
@@ -652,7 +796,7 @@ int Cec_ManSimAnalyzeOutputs( Cec_ManSim_t * p )
 int Cec_ManSimSimulateRound( Cec_ManSim_t * p, Vec_Ptr_t * vInfoCis, Vec_Ptr_t * vInfoCos )
 {
     Gia_Obj_t * pObj;
-    unsigned * pRes0, * pRes1, * pRes;
+    unsigned * pRes0, * pRes1, * pRes, * pMemsRef = p->pMems;
     int i, k, w, Ent, iCiId = 0, iCoId = 0;
     // prepare internal storage
     if ( p->nWordsOld != p->nWords )
@@ -664,6 +808,8 @@ int Cec_ManSimSimulateRound( Cec_ManSim_t * p, Vec_Ptr_t * vInfoCis, Vec_Ptr_t *
         p->pScores = ABC_CALLOC( int, 32 * p->nWords );
     // simulate nodes
     Vec_IntClear( p->vRefinedC );
+    if ( p->pPars->nThreads > 1 && Cec_ManSimSimulatePar( p, vInfoCis, vInfoCos ) )
+        goto finalize;
     if ( Gia_ObjValue(Gia_ManConst0(p->pAig)) )
     {
         pRes = Cec_ManSimSimRef( p, 0 );
@@ -760,23 +906,37 @@ references:
         }
     }
 
+    assert( vInfoCis == NULL || iCiId == Gia_ManCiNum(p->pAig) );
+    assert( vInfoCos == NULL || iCoId == Gia_ManCoNum(p->pAig) );
+
+finalize:
     if ( p->pPars->fConstCorr )
     {
         Vec_IntForEachEntry( p->vRefinedC, i, k )
         {
             Gia_ObjSetRepr( p->pAig, i, GIA_VOID );
-            Cec_ManSimSimDeref( p, i );
+            if ( !p->fSimsAll )
+                Cec_ManSimSimDeref( p, i );
         }
         Vec_IntClear( p->vRefinedC );
     }
 
     if ( Vec_IntSize(p->vRefinedC) > 0 )
         Cec_ManSimProcessRefined( p, p->vRefinedC );
-    assert( vInfoCis == NULL || iCiId == Gia_ManCiNum(p->pAig) );
-    assert( vInfoCos == NULL || iCoId == Gia_ManCoNum(p->pAig) );
-    assert( p->nMems == 1 );
-    if ( p->nMems != 1 )
-        Abc_Print( 1, "Cec_ManSimSimulateRound(): Memory management error!\n" );
+    if ( p->fSimsAll )
+    {
+        // return to the reference-counted memory
+        ABC_FREE( p->pMems );
+        p->pMems = pMemsRef;
+        memset( p->pSimInfo, 0, sizeof(int) * Gia_ManObjNum(p->pAig) );
+        p->fSimsAll = 0;
+    }
+    else
+    {
+        assert( p->nMems == 1 );
+        if ( p->nMems != 1 )
+            Abc_Print( 1, "Cec_ManSimSimulateRound(): Memory management error!\n" );
+    }
     if ( p->pPars->fVeryVerbose )
         Gia_ManEquivPrintClasses( p->pAig, 0, Cec_MemUsage(p) );
     if ( p->pBestState )
@@ -75,6 +75,7 @@ void Cec_ManSimSetDefaultParams( Cec_ParSim_t * p )
     p->nRounds        =      20;  // the max number of simulation rounds
     p->nNonRefines    =       3;  // the max number of rounds without refinement
     p->TimeLimit      =       0;  // the runtime limit in seconds
+    p->nThreads       =       1;  // the number of simulation threads
     p->fCheckMiter    =       0;  // the circuit is the miter
 //    p->fFirstStop     =       0;  // stop on the first sat output
     p->fDualOut       =       0;  // miter with separate outputs
@@ -132,6 +133,7 @@ void Cec_ManFraSetDefaultParams( Cec_ParFra_t * p )
     p->nBTLimit       =     100;  // conflict limit at a node
     p->nLevelMax      =       0;  // restriction on the level of nodes to be swept
     p->nDepthMax      =       1;  // the depth in terms of steps of speculative reduction
+    p->nProcs         =       1;  // the number of threads of simulation and SAT sweeping
     p->fRewriting     =       0;  // enables AIG rewriting
     p->fCheckMiter    =       0;  // the circuit is the miter
 //    p->fFirstStop     =       0;  // stop on the first sat output
@@ -188,6 +190,7 @@ void Cec_ManCorSetDefaultParams( Cec_ParCor_t * p )
     p->nBTLimit       =     100;  // conflict limit at a node
     p->nLevelMax      =      -1;  // (scorr only) the max number of levels
     p->nStepsMax      =      -1;  // (scorr only) the max number of induction steps
+    p->nProcs         =       1;  // the number of simulation threads
     p->fLatchCorr     =       0;  // consider only latch outputs
     p->fConstCorr     =       0;  // consider only constants
     p->fUseRings      =       1;  // combine classes into rings
@@ -379,6 +382,7 @@ Gia_Man_t * Cec_ManSatSweeping( Gia_Man_t * pAig, Cec_ParFra_t * pPars, int fSil
     pParsSim->nFrames     = pPars->nRounds;
     pParsSim->fCheckMiter = pPars->fCheckMiter;
     pParsSim->fDualOut    = pPars->fDualOut;
+    pParsSim->nThreads    = pPars->nProcs;
     pParsSim->fVerbose    = pPars->fVerbose;
     pSim = Cec_ManSimStart( pIni, pParsSim );
     // SAT solving
@@ -784,6 +784,7 @@ void Cec_ManLSCorrespondenceBmc( Gia_Man_t * pAig, Cec_ParCor_t * pPars, int nPr
     pParsSim->nFrames    = pPars->nRounds;
     pParsSim->fVerbose   = pPars->fVerbose;
     pParsSim->fLatchCorr = pPars->fLatchCorr;
+    pParsSim->nThreads   = pPars->nProcs;
     pParsSim->fSeqSimulate = 1;
     pSim = Cec_ManSimStart( pAig, pParsSim );
     // prepare SAT solving
@@ -935,6 +936,7 @@ int Cec_ManLSCorrespondenceClasses( Gia_Man_t * pAig, Cec_ParCor_t * pPars )
     pParsSim->fVerbose   = pPars->fVerbose;
     pParsSim->fLatchCorr = pPars->fLatchCorr;
     pParsSim->fConstCorr = pPars->fConstCorr;
+    pParsSim->nThreads   = pPars->nProcs;
     pParsSim->fSeqSimulate = 1;
     // create equivalence classes of registers
     pSim = Cec_ManSimStart( pAig, pParsSim );
@@ -123,6 +123,7 @@ struct Cec_ManSim_t_
     int              nMemsMax;       // the max number of used entries 
     int              MemFree;        // next free entry
     int              nWordsOld;      // the number of simulation words after previous relink
+    int              fSimsAll;       // every object has its own simulation info
     // internal simulation info
     Vec_Ptr_t *      vCiSimInfo;     // CI simulation info  
     Vec_Ptr_t *      vCoSimInfo;     // CO simulation info  
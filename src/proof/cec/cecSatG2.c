@@ -74,6 +74,17 @@
 
 #endif
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -109,6 +120,11 @@ struct Cec4_Man_t_
     Vec_Int_t *      vRefBins;
     int *            pTable;
     int              nTableSize;
+    // parallel sweeping
+    Vec_Int_t *      vJobs;          // candidate pairs (iObj, iRepr, LitRepr, LitObj) waiting for the workers
+    Vec_Int_t *      vJobRes;        // status and easiness of each pair
+    Vec_Wrd_t *      vJobTimes;      // solving time of each pair
+    Vec_Wec_t *      vJobPats;       // counter-example of each disproved pair as CI literals
     // statistics
     int              nItersSim;
     int              nItersSat;
@@ -168,6 +184,7 @@ void Cec4_ManSetParams( Cec_ParFra_t * pPars )
     pPars->nSatVarMax     =    1000;    // the max number of SAT variables before recycling SAT solver
     pPars->nCallsRecycle  =     500;    // calls to perform before recycling SAT solver
     pPars->nGenIters      =     100;    // pattern generation iterations
+    pPars->nProcs         =       1;    // the number of worker threads
 }
 
 /**Function*************************************************************
@@ -244,6 +261,10 @@ void Cec4_ManDestroy( Cec4_Man_t * p )
     Vec_IntFreeP( &p->vRefClasses );
     Vec_IntFreeP( &p->vRefNodes );
     Vec_IntFreeP( &p->vRefBins );
+    Vec_IntFreeP( &p->vJobs );
+    Vec_IntFreeP( &p->vJobRes );
+    Vec_WrdFreeP( &p->vJobTimes );
+    Vec_WecFreeP( &p->vJobPats );
     ABC_FREE( p->pTable );
     ABC_FREE( p );
 }
@@ -862,21 +883,64 @@ int Cec4_ManSimulateCos( Gia_Man_t * p )
     }
     return 1;
 }
+typedef struct Cec4_SimThData_t_ Cec4_SimThData_t;
+struct Cec4_SimThData_t_
+{
+    Gia_Man_t *      p;              // the AIG with simulation info
+    int              wStart;         // the first word of this thread
+    int              wStop;          // the word after the last word of this thread
+};
+void * Cec4_ManSimulateThread( void * pArg )
+{
+    Cec4_SimThData_t * pThData = (Cec4_SimThData_t *)pArg;
+    Gia_Man_t * p = pThData->p;
+    Gia_Obj_t * pObj; int i, w;
+    Gia_ManForEachAnd( p, pObj, i )
+    {
+        word * pSim  = Cec4_ObjSim( p, i );
+        word * pSim0 = Cec4_ObjSim( p, Gia_ObjFaninId0(pObj, i) );
+        word * pSim1 = Cec4_ObjSim( p, Gia_ObjFaninId1(pObj, i) );
+        word Mask0 = Gia_ObjFaninC0(pObj) ? ~(word)0 : 0;
+        word Mask1 = Gia_ObjFaninC1(pObj) ? ~(word)0 : 0;
+        if ( Gia_ObjIsXor(pObj) )
+            for ( w = pThData->wStart; w < pThData->wStop; w++ )
+                pSim[w] = (pSim0[w] ^ Mask0) ^ (pSim1[w] ^ Mask1);
+        else
+            for ( w = pThData->wStart; w < pThData->wStop; w++ )
+                pSim[w] = (pSim0[w] ^ Mask0) & (pSim1[w] ^ Mask1);
+    }
+    return NULL;
+}
+void Cec4_ManSimulatePar( Gia_Man_t * p, int nThreads )
+{
+    Cec4_SimThData_t ThData[GIA_SIM_THR_MAX];
+    int i;
+    for ( i = 0; i < nThreads; i++ )
+    {
+        ThData[i].p = p;
+        Gia_ManSimShardRange( p->nSimWords, nThreads, 8, i, &ThData[i].wStart, &ThData[i].wStop );
+    }
+    Gia_ManSimRunThreads( Cec4_ManSimulateThread, ThData, sizeof(Cec4_SimThData_t), nThreads );
+}
 void Cec4_ManSimulate( Gia_Man_t * p, Cec4_Man_t * pMan )
 {
     abctime clk = Abc_Clock();
     Gia_Obj_t * pObj; int i;
+    int nThreads = Gia_ManSimShardNum( p->nSimWords, pMan->pPars->nProcs, 8 );
     pMan->nSimulates++;
     if ( pMan->pTable == NULL )
         Cec4_RefineInit( p, pMan );
     else
         assert( Vec_IntSize(pMan->vRefClasses) == 0 );
+    // with several threads, the nodes are simulated first and the classes are checked after
+    if ( nThreads > 1 )
+        Cec4_ManSimulatePar( p, nThreads );
     Gia_ManForEachAnd( p, pObj, i )
     {
         int iRepr = Gia_ObjRepr( p, i );
-        if ( Gia_ObjIsXor(pObj) )
+        if ( nThreads == 1 && Gia_ObjIsXor(pObj) )
             Cec4_ObjSimXor( p, i );
-        else
+        else if ( nThreads == 1 )
             Cec4_ObjSimAnd( p, i );
         if ( iRepr == GIA_VOID || p->pReprs[iRepr].fColorA || Cec4_ObjSimEqual(p, iRepr, i) )
             continue;
@@ -1534,44 +1598,53 @@ int Cec4_ManSolveTwo( Cec4_Man_t * p, int iObj0, int iObj1, int fPhase, int * pf
     }
     return status;
 }
-int Cec4_ManSweepNode( Cec4_Man_t * p, int iObj, int iRepr )
+void Cec4_ManCollectPattern( Cec4_Man_t * p, Vec_Int_t * vCiIds, Vec_Int_t * vPat )
 {
-    abctime clk = Abc_Clock();
-    int i, IdAig, IdSat, status, fEasy, RetValue = 1;
+    int i, IdAig, IdSat;
+    Vec_IntClear( vPat );
+    if ( p->pPars->jType == 0 )
+    {
+        Vec_IntForEachEntryDouble( &p->pNew->vCopiesTwo, IdAig, IdSat, i )
+            Vec_IntPush( vPat, Abc_Var2Lit(IdAig, sat_solver_read_cex_varvalue(p->pSat, IdSat)) );
+    }
+    else
+    {
+        int * pCex = sat_solver_read_cex( p->pSat );
+        int * pMap = Vec_IntArray(&p->pNew->vVarMap);
+        for ( i = 0; i < pCex[0]; )
+            Vec_IntPush( vPat, Abc_Lit2LitV(pMap, Abc_LitNot(pCex[++i])) );
+    }
+    // translate the CIs of the window into the CIs of the user's AIG
+    if ( vCiIds == NULL )
+        return;
+    Vec_IntForEachEntry( vPat, IdSat, i )
+    {
+        Gia_Obj_t * pObj = Gia_ManObj( p->pNew, Abc_Lit2Var(IdSat) );
+        assert( Gia_ObjIsCi(pObj) );
+        Vec_IntWriteEntry( vPat, i, Abc_Var2Lit(Vec_IntEntry(vCiIds, Gia_ObjCioId(pObj)), Abc_LitIsCompl(IdSat)) );
+    }
+}
+int Cec4_ManSweepNodeUpdate( Cec4_Man_t * p, int iObj, int iRepr, int status, int fEasy, Vec_Int_t * vPat, abctime clkSolve )
+{
+    int i, iLit, RetValue = 1;
     Gia_Obj_t * pObj = Gia_ManObj( p->pAig, iObj );
     Gia_Obj_t * pRepr = Gia_ManObj( p->pAig, iRepr );
-    int fCompl = Abc_LitIsCompl(pObj->Value) ^ Abc_LitIsCompl(pRepr->Value) ^ pObj->fPhase ^ pRepr->fPhase;
-    status = Cec4_ManSolveTwo( p, Abc_Lit2Var(pRepr->Value), Abc_Lit2Var(pObj->Value), fCompl, &fEasy, p->pPars->fVerbose );
     if ( status == GLUCOSE_SAT )
     {
-        int iLit;
         //int iPatsOld = p->pAig->iPatsPi;
         //printf( "Disproved: %d == %d.\n", Abc_Lit2Var(pRepr->Value), Abc_Lit2Var(pObj->Value) );
         p->nSatSat++;
         p->nPatterns++;
-        Vec_IntClear( p->vPat );
-        if ( p->pPars->jType == 0 )
-        {
-            Vec_IntForEachEntryDouble( &p->pNew->vCopiesTwo, IdAig, IdSat, i )
-                Vec_IntPush( p->vPat, Abc_Var2Lit(IdAig, sat_solver_read_cex_varvalue(p->pSat, IdSat)) );
-        }
-        else
-        {
-            int * pCex = sat_solver_read_cex( p->pSat );
-            int * pMap = Vec_IntArray(&p->pNew->vVarMap);
-            for ( i = 0; i < pCex[0]; )
-                Vec_IntPush( p->vPat, Abc_Lit2LitV(pMap, Abc_LitNot(pCex[++i])) );
-        }
         assert( p->pAig->iPatsPi >= 0 && p->pAig->iPatsPi < 64 * p->pAig->nSimWords - 1 );
         p->pAig->iPatsPi++;
-        Vec_IntForEachEntry( p->vPat, iLit, i )
+        Vec_IntForEachEntry( vPat, iLit, i )
             Cec4_ObjSimSetInputBit( p->pAig, Abc_Lit2Var(iLit), Abc_LitIsCompl(iLit) );
         //Cec4_ManPackAddPattern( p->pAig, p->vPat, 0 );
         //assert( iPatsOld + 1 == p->pAig->iPatsPi );
         if ( fEasy )
-            p->timeSatSat0 += Abc_Clock() - clk;
+            p->timeSatSat0 += clkSolve;
         else
-            p->timeSatSat += Abc_Clock() - clk;
+            p->timeSatSat += clkSolve;
         RetValue = 0;
         // this is not needed, but we keep it here anyway, because it takes very little time
         //Cec4_ManVerify( p->pNew, Abc_Lit2Var(pRepr->Value), Abc_Lit2Var(pObj->Value), fCompl, p->pSat );
@@ -1594,14 +1667,14 @@ int Cec4_ManSweepNode( Cec4_Man_t * p, int iObj, int iRepr )
     {
         //printf( "Proved: %d == %d.\n", Abc_Lit2Var(pRepr->Value), Abc_Lit2Var(pObj->Value) );
         p->nSatUnsat++;
-        pObj->Value = Abc_LitNotCond( pRepr->Value, fCompl );
+        pObj->Value = Abc_LitNotCond( pRepr->Value, pObj->fPhase ^ pRepr->fPhase );
         Gia_ObjSetProved( p->pAig, iObj );
         if ( iRepr == 0 )
             p->iLastConst = iObj;
         if ( fEasy )
-            p->timeSatUnsat0 += Abc_Clock() - clk;
+            p->timeSatUnsat0 += clkSolve;
         else
-            p->timeSatUnsat += Abc_Clock() - clk;
+            p->timeSatUnsat += clkSolve;
         RetValue = 1;
     }
     else 
@@ -1612,11 +1685,23 @@ int Cec4_ManSweepNode( Cec4_Man_t * p, int iObj, int iRepr )
         Vec_BitWriteEntry( p->vFails, iObj, 1 );
         //if ( iRepr )
         //Vec_BitWriteEntry( p->vFails, iRepr, 1 );
-        p->timeSatUndec += Abc_Clock() - clk;
+        p->timeSatUndec += clkSolve;
         RetValue = 2;
     }
     return RetValue;
 }
+int Cec4_ManSweepNode( Cec4_Man_t * p, int iObj, int iRepr )
+{
+    abctime clk = Abc_Clock();
+    int status, fEasy;
+    Gia_Obj_t * pObj = Gia_ManObj( p->pAig, iObj );
+    Gia_Obj_t * pRepr = Gia_ManObj( p->pAig, iRepr );
+    int fCompl = Abc_LitIsCompl(pObj->Value) ^ Abc_LitIsCompl(pRepr->Value) ^ pObj->fPhase ^ pRepr->fPhase;
+    status = Cec4_ManSolveTwo( p, Abc_Lit2Var(pRepr->Value), Abc_Lit2Var(pObj->Value), fCompl, &fEasy, p->pPars->fVerbose );
+    if ( status == GLUCOSE_SAT )
+        Cec4_ManCollectPattern( p, NULL, p->vPat );
+    return Cec4_ManSweepNodeUpdate( p, iObj, iRepr, status, fEasy, p->vPat, Abc_Clock() - clk );
+}
 Gia_Obj_t * Cec4_ManFindRepr( Gia_Man_t * p, Cec4_Man_t * pMan, int iObj )
 {
     abctime clk = Abc_Clock();
@@ -1651,10 +1736,433 @@ Gia_Obj_t * Cec4_ManFindRepr( Gia_Man_t * p, Cec4_Man_t * pMan, int iObj )
     pMan->timeResimLoc += Abc_Clock() - clk;
     return NULL;
 }
+static inline void Cec4_ManStrashNode( Cec4_Man_t * pMan, Gia_Obj_t * pObj )
+{
+    if ( Gia_ObjIsXor(pObj) )
+        pObj->Value = Gia_ManHashXorReal( pMan->pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+    else
+        pObj->Value = Gia_ManHashAnd( pMan->pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Parallel SAT sweeping.]
+
+  Description [The sweeping loop queues the candidate pairs instead of
+  solving them and keeps building the new AIG from the unmerged nodes.
+  Once a batch is full, it is cut into windows of consecutive pairs (the
+  nodes close in the topological order tend to share their fanin cones)
+  and the windows are handed to the worker threads. A worker copies the
+  TFI cones of its pairs from the new AIG into a small AIG of its own and
+  solves them there with its own solver and CNF mapping, so nothing is
+  shared except the new AIG, which nobody changes while a batch is in
+  flight. The results are then applied in the original order through
+  Cec4_ManSweepNodeUpdate(), which feeds the counter-examples into the
+  simulation and refinement of the main manager, and the nodes of the
+  batch are strashed again, so that their fanouts see the merges. Pairs
+  merged structurally are queued with LitRepr = -1 and are not solved.
+  A pair whose cones contain an unmerged node of a queued pair is not
+  queued before the batch is solved, otherwise it would be solved without
+  the merges the serial sweeping would have used.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifndef ABC_USE_PTHREADS
+
+void * Cec4_ManParStart( Cec4_Man_t * p, int nProcs ) { return NULL; }
+void   Cec4_ManParSolve( void * pPar, int iStop )     {               }
+int    Cec4_ManParFull( void * pPar )                 { return 0;     }
+int    Cec4_ManParDepends( void * pPar, int iLit )    { return 0;     }
+void   Cec4_ManParQueue( void * pPar, int iObj, int iRepr, int LitRepr, int LitObj ) { }
+void   Cec4_ManParStop( void * pPar )                 {               }
+
+#else // pthreads are used
+
+#define CEC4_PAR_THR_MAX  100   // the max number of worker threads
+#define CEC4_PAR_WIN       32   // the number of pairs in one window
+#define CEC4_PAR_WINS       4   // the number of windows per worker in one batch
+
+typedef struct Cec4_Par_t_ Cec4_Par_t;
+typedef struct Cec4_ThData_t_ Cec4_ThData_t;
+struct Cec4_ThData_t_
+{
+    Cec4_Par_t *     pPar;           // the parallel manager (its mutex protects fWorking)
+    Cec4_Man_t *     pMain;          // the main manager (only read, except the results of own pairs)
+    Cec4_Man_t *     pMan;           // the solver of this worker, its pNew is the current window
+    Vec_Int_t *      vMap;           // window literal of each node of the new AIG, -1 if not copied
+    Vec_Int_t *      vVisited;       // nodes of the new AIG copied into the current window
+    Vec_Int_t *      vCiIds;         // CI object ID of the user's AIG for each CI of the window
+    int              iStart;         // the first pair of the window
+    int              iStop;          // the last pair of the window plus one, -1 stops the thread
+    int              fWorking;       // the window is assigned and not solved yet
+    pthread_cond_t   CondWork;       // signaled when the window is assigned
+};
+
+struct Cec4_Par_t_
+{
+    Cec4_Man_t *     pMain;          // the main manager
+    int              nProcs;         // the number of worker threads
+    Vec_Int_t *      vDeps;          // Stamp for nodes of the new AIG independent of the queued pairs, Stamp+1 for dependent ones
+    int              Stamp;          // the stamp of the current batch
+    int              iFirst;         // the smallest node of the new AIG among the queued pairs
+    int              nBatches;       // the number of batches solved
+    int              nBatchMin;      // the smallest batch
+    int              nBatchMax;      // the largest batch
+    word             nBatchPairs;    // the number of pairs in all batches
+    pthread_mutex_t  Mutex;          // protects fWorking of the workers
+    pthread_cond_t   CondDone;       // signaled when a worker has solved its window
+    Cec4_ThData_t    ThData[CEC4_PAR_THR_MAX];
+    pthread_t        WorkerThread[CEC4_PAR_THR_MAX];
+};
+
+Cec4_Man_t * Cec4_ManParCreateWorker( Cec4_Man_t * pMain )
+{
+    Cec4_Man_t * p = ABC_CALLOC( Cec4_Man_t, 1 );
+    p->pPars     = pMain->pPars;
+    p->pAig      = pMain->pAig;
+    p->pSat      = sat_solver_start();
+    sat_solver_set_jftr( p->pSat, p->pPars->jType );
+    p->vFrontier = Vec_PtrAlloc( 1000 );
+    p->vFanins   = Vec_PtrAlloc( 100 );
+    p->vFails    = Vec_BitAlloc( 1000 );
+    return p;
+}
+void Cec4_ManParDestroyWorker( Cec4_Man_t * p )
+{
+    assert( p->pNew == NULL );
+    sat_solver_stop( p->pSat );
+    Vec_PtrFreeP( &p->vFrontier );
+    Vec_PtrFreeP( &p->vFanins );
+    Vec_BitFreeP( &p->vFails );
+    ABC_FREE( p );
+}
+
+// copies the TFI cone of the node of the new AIG into the window
+int Cec4_ManParWindow_rec( Cec4_ThData_t * pThData, Gia_Man_t * pWin, int iObj )
+{
+    Gia_Man_t * pNew = pThData->pMain->pNew;
+    Gia_Obj_t * pObj = Gia_ManObj( pNew, iObj );
+    int iLit0, iLit1, iLit = Vec_IntEntry( pThData->vMap, iObj );
+    if ( iLit >= 0 )
+        return iLit;
+    if ( Gia_ObjIsCi(pObj) )
+    {
+        iLit = Gia_ManAppendCi( pWin );
+        Vec_IntPush( pThData->vCiIds, Gia_ManCiIdToId(pThData->pMain->pAig, Gia_ObjCioId(pObj)) );
+    }
+    else
+    {
+        assert( Gia_ObjIsAnd(pObj) );
+        iLit0 = Abc_LitNotCond( Cec4_ManParWindow_rec(pThData, pWin, Gia_ObjFaninId0(pObj, iObj)), Gia_ObjFaninC0(pObj) );
+        iLit1 = Abc_LitNotCond( Cec4_ManParWindow_rec(pThData, pWin, Gia_ObjFaninId1(pObj, iObj)), Gia_ObjFaninC1(pObj) );
+        if ( Gia_ObjIsXor(pObj) )
+            iLit = Gia_ManAppendXorReal( pWin, iLit0, iLit1 );
+        else
+            iLit = Gia_ManAppendAnd( pWin, iLit0, iLit1 );
+    }
+    Vec_IntWriteEntry( pThData->vMap, iObj, iLit );
+    Vec_IntPush( pThData->vVisited, iObj );
+    return iLit;
+}
+Gia_Man_t * Cec4_ManParWindow( Cec4_ThData_t * pThData )
+{
+    Cec4_Man_t * p = pThData->pMain;
+    Gia_Man_t * pWin;
+    int i, iObj;
+    pWin = Gia_ManStart( 1000 );
+    if ( p->pNew->pMuxes )
+        pWin->pMuxes = ABC_CALLOC( unsigned, pWin->nObjsAlloc );
+    Vec_IntFillExtra( pThData->vMap, Gia_ManObjNum(p->pNew), -1 );
+    Vec_IntWriteEntry( pThData->vMap, 0, 0 );
+    Vec_IntClear( pThData->vVisited );
+    Vec_IntClear( pThData->vCiIds );
+    for ( i = pThData->iStart; i < pThData->iStop; i++ )
+    {
+        if ( Vec_IntEntry(p->vJobs, 4*i+2) == -1 )
+            continue;
+        Cec4_ManParWindow_rec( pThData, pWin, Abc_Lit2Var(Vec_IntEntry(p->vJobs, 4*i+2)) );
+        Cec4_ManParWindow_rec( pThData, pWin, Abc_Lit2Var(Vec_IntEntry(p->vJobs, 4*i+3)) );
+    }
+    // the SAT variables and the failed nodes of the window
+    Vec_IntFill( &pWin->vCopies2, Gia_ManObjNum(pWin), -1 );
+    Vec_BitFill( pThData->pMan->vFails, Gia_ManObjNum(pWin), 0 );
+    Vec_IntForEachEntry( pThData->vVisited, iObj, i )
+        if ( Vec_BitEntry(p->vFails, iObj) )
+            Vec_BitWriteEntry( pThData->pMan->vFails, Abc_Lit2Var(Vec_IntEntry(pThData->vMap, iObj)), 1 );
+    return pWin;
+}
+
+// solves the pairs of one window, runs on the worker thread
+void Cec4_ManParSolveWindow( Cec4_ThData_t * pThData )
+{
+    Cec4_Man_t * p = pThData->pMain, * pW = pThData->pMan;
+    int i, iObj, status, fEasy, iWin0, iWin1, fCompl;
+    abctime clk;
+    pW->pNew = Cec4_ManParWindow( pThData );
+    for ( i = pThData->iStart; i < pThData->iStop; i++ )
+    {
+        int * pJob = Vec_IntEntryP( p->vJobs, 4*i );
+        Gia_Obj_t * pObj = Gia_ManObj( p->pAig, pJob[0] );
+        Gia_Obj_t * pRepr = Gia_ManObj( p->pAig, pJob[1] );
+        if ( pJob[2] == -1 )
+            continue;
+        clk    = Abc_Clock();
+        fCompl = Abc_LitIsCompl(pJob[3]) ^ Abc_LitIsCompl(pJob[2]) ^ pObj->fPhase ^ pRepr->fPhase;
+        iWin0  = Abc_Lit2Var( Vec_IntEntry(pThData->vMap, Abc_Lit2Var(pJob[2])) );
+        iWin1  = Abc_Lit2Var( Vec_IntEntry(pThData->vMap, Abc_Lit2Var(pJob[3])) );
+        status = Cec4_ManSolveTwo( pW, iWin0, iWin1, fCompl, &fEasy, p->pPars->fVerbose );
+        if ( status == GLUCOSE_SAT )
+            Cec4_ManCollectPattern( pW, pThData->vCiIds, Vec_WecEntry(p->vJobPats, i) );
+        Vec_IntWriteEntry( p->vJobRes, 2*i, status );
+        Vec_IntWriteEntry( p->vJobRes, 2*i+1, fEasy );
+        Vec_WrdWriteEntry( p->vJobTimes, i, (word)(Abc_Clock() - clk) );
+    }
+    // the window goes away together with the SAT variables of its nodes
+    sat_solver_reset( pW->pSat );
+    pW->nCallsSince = 0;
+    Gia_ManStopP( &pW->pNew );
+    Vec_IntForEachEntry( pThData->vVisited, iObj, i )
+        Vec_IntWriteEntry( pThData->vMap, iObj, -1 );
+}
+// waits on its condition variable until a window is assigned
+void * Cec4_ManParWorkerThread( void * pArg )
+{
+    Cec4_ThData_t * pThData = (Cec4_ThData_t *)pArg;
+    Cec4_Par_t * pPar = pThData->pPar;
+    int status;
+    while ( 1 )
+    {
+        status = pthread_mutex_lock( &pPar->Mutex );  assert( status == 0 );
+        while ( !pThData->fWorking )
+        {
+            status = pthread_cond_wait( &pThData->CondWork, &pPar->Mutex );  assert( status == 0 );
+        }
+        status = pthread_mutex_unlock( &pPar->Mutex );  assert( status == 0 );
+        if ( pThData->iStop == -1 )
+        {
+            pthread_exit( NULL );
+            assert( 0 );
+            return NULL;
+        }
+        Cec4_ManParSolveWindow( pThData );
+        status = pthread_mutex_lock( &pPar->Mutex );  assert( status == 0 );
+        pThData->fWorking = 0;
+        status = pthread_cond_signal( &pPar->CondDone );  assert( status == 0 );
+        status = pthread_mutex_unlock( &pPar->Mutex );  assert( status == 0 );
+    }
+    assert( 0 );
+    return NULL;
+}
+
+void * Cec4_ManParStart( Cec4_Man_t * p, int nProcs )
+{
+    Cec4_Par_t * pPar = ABC_CALLOC( Cec4_Par_t, 1 );
+    int i, status;
+    if ( nProcs > CEC4_PAR_THR_MAX )
+        printf( "Warning: The number of threads is reduced to %d.\n", CEC4_PAR_THR_MAX );
+    pPar->pMain  = p;
+    pPar->nProcs = Abc_MinInt( nProcs, CEC4_PAR_THR_MAX );
+    pPar->vDeps  = Vec_IntAlloc( 0 );
+    pPar->Stamp  = 1;
+    status = pthread_mutex_init( &pPar->Mutex, NULL );  assert( status == 0 );
+    status = pthread_cond_init( &pPar->CondDone, NULL );  assert( status == 0 );
+    p->vJobs     = Vec_IntAlloc( 4 * CEC4_PAR_WIN * CEC4_PAR_WINS * pPar->nProcs );
+    p->vJobRes   = Vec_IntAlloc( 2 * CEC4_PAR_WIN * CEC4_PAR_WINS * pPar->nProcs );
+    p->vJobTimes = Vec_WrdAlloc( CEC4_PAR_WIN * CEC4_PAR_WINS * pPar->nProcs );
+    p->vJobPats  = Vec_WecAlloc( CEC4_PAR_WIN * CEC4_PAR_WINS * pPar->nProcs );
+    for ( i = 0; i < pPar->nProcs; i++ )
+    {
+        Cec4_ThData_t * pThData = pPar->ThData + i;
+        pThData->pPar     = pPar;
+        pThData->pMain    = p;
+        pThData->pMan     = Cec4_ManParCreateWorker( p );
+        pThData->vMap     = Vec_IntAlloc( 0 );
+        pThData->vVisited = Vec_IntAlloc( 1000 );
+        pThData->vCiIds   = Vec_IntAlloc( 100 );
+        pThData->iStart   = 0;
+        pThData->iStop    = 0;
+        pThData->fWorking = 0;
+        status = pthread_cond_init( &pThData->CondWork, NULL );  assert( status == 0 );
+        status = pthread_create( pPar->WorkerThread + i, NULL, Cec4_ManParWorkerThread, (void *)pThData );  assert( status == 0 );
+    }
+    return pPar;
+}
+
+// solves the queued pairs and applies the results to the nodes built since the last batch
+void Cec4_ManParSolve( void * pArg, int iStop )
+{
+    Cec4_Par_t * pPar = (Cec4_Par_t *)pArg;
+    Cec4_Man_t * p = pPar->pMain;
+    Gia_Obj_t * pObj, * pRepr;
+    int i, k, nJobs = Vec_IntSize(p->vJobs) / 4, iNext = 0, nBusy = 0, fChange, status;
+    if ( nJobs == 0 )
+        return;
+    pPar->nBatchMin = pPar->nBatches ? Abc_MinInt( pPar->nBatchMin, nJobs ) : nJobs;
+    pPar->nBatchMax = Abc_MaxInt( pPar->nBatchMax, nJobs );
+    pPar->nBatchPairs += nJobs;
+    pPar->nBatches++;
+    Vec_IntFill( p->vJobRes, 2 * nJobs, -1 );
+    Vec_WrdFill( p->vJobTimes, nJobs, 0 );
+    Vec_WecInit( p->vJobPats, nJobs );
+    if ( nJobs <= CEC4_PAR_WIN ) // not worth waking up a worker
+    {
+        pPar->ThData[0].iStart = 0;
+        pPar->ThData[0].iStop  = iNext = nJobs;
+        Cec4_ManParSolveWindow( pPar->ThData );
+        pPar->ThData[0].iStart = pPar->ThData[0].iStop = 0;
+    }
+    // assign the windows to the idle workers and sleep until one of them is done
+    status = pthread_mutex_lock( &pPar->Mutex );  assert( status == 0 );
+    while ( iNext < nJobs || nBusy > 0 )
+    {
+        fChange = 0;
+        for ( i = 0; i < pPar->nProcs; i++ )
+        {
+            Cec4_ThData_t * pThData = pPar->ThData + i;
+            if ( pThData->fWorking )
+                continue;
+            if ( pThData->iStop > pThData->iStart )
+            {
+                pThData->iStart = pThData->iStop = 0;
+                nBusy--;
+                fChange = 1;
+            }
+            if ( iNext == nJobs )
+                continue;
+            pThData->iStart = iNext;
+            pThData->iStop  = iNext = Abc_MinInt( iNext + CEC4_PAR_WIN, nJobs );
+            nBusy++;
+            fChange = 1;
+            pThData->fWorking = 1;
+            status = pthread_cond_signal( &pThData->CondWork );  assert( status == 0 );
+        }
+        if ( !fChange )
+        {
+            status = pthread_cond_wait( &pPar->CondDone, &pPar->Mutex );  assert( status == 0 );
+        }
+    }
+    status = pthread_mutex_unlock( &pPar->Mutex );  assert( status == 0 );
+    // the nodes before the first pair did not change
+    for ( i = 0, k = Vec_IntEntry(p->vJobs, 0); k < iStop; k++ )
+    {
+        pObj = Gia_ManObj( p->pAig, k );
+        if ( !Gia_ObjIsAnd(pObj) )
+            continue;
+        Cec4_ManStrashNode( p, pObj );
+        if ( i == nJobs || Vec_IntEntry(p->vJobs, 4*i) != k )
+            continue;
+        pRepr = Gia_ManObj( p->pAig, Vec_IntEntry(p->vJobs, 4*i+1) );
+        if ( Vec_IntEntry(p->vJobs, 4*i+2) == -1 )
+            assert( Gia_ObjProved(p->pAig, k) );
+        else
+            Cec4_ManSweepNodeUpdate( p, k, Gia_ObjId(p->pAig, pRepr), Vec_IntEntry(p->vJobRes, 2*i), Vec_IntEntry(p->vJobRes, 2*i+1),
+                Vec_WecEntry(p->vJobPats, i), (abctime)Vec_WrdEntry(p->vJobTimes, i) );
+        if ( Gia_ObjProved(p->pAig, k) )
+            pObj->Value = Abc_LitNotCond( pRepr->Value, pObj->fPhase ^ pRepr->fPhase );
+        i++;
+    }
+    assert( i == nJobs );
+    Vec_IntClear( p->vJobs );
+    pPar->Stamp += 2;
+    // the failed nodes are also looked up by the IDs of the new AIG, which is now larger
+    // than the user's AIG and can get at most one node for each of its remaining nodes
+    Vec_BitFillExtra( p->vFails, Gia_ManObjNum(p->pNew) + Gia_ManObjNum(p->pAig) - iStop, 0 );
+}
+int Cec4_ManParFull( void * pArg )
+{
+    Cec4_Par_t * pPar = (Cec4_Par_t *)pArg;
+    return Vec_IntSize(pPar->pMain->vJobs) >= 4 * CEC4_PAR_WIN * CEC4_PAR_WINS * pPar->nProcs;
+}
+// returns 1 if the node of the new AIG has an unmerged node of a queued pair in its TFI
+int Cec4_ManParDepends_rec( Cec4_Par_t * pPar, int iObj, int iFirst )
+{
+    Gia_Obj_t * pObj;
+    int Entry, fDep = 0;
+    if ( iObj < iFirst )
+        return 0;
+    Entry = Vec_IntEntry( pPar->vDeps, iObj );
+    if ( Entry == pPar->Stamp || Entry == pPar->Stamp + 1 )
+        return Entry - pPar->Stamp;
+    pObj = Gia_ManObj( pPar->pMain->pNew, iObj );
+    if ( Gia_ObjIsAnd(pObj) )
+        fDep = Cec4_ManParDepends_rec( pPar, Gia_ObjFaninId0(pObj, iObj), iFirst ) ||
+               Cec4_ManParDepends_rec( pPar, Gia_ObjFaninId1(pObj, iObj), iFirst );
+    Vec_IntWriteEntry( pPar->vDeps, iObj, pPar->Stamp + fDep );
+    return fDep;
+}
+int Cec4_ManParDepends( void * pArg, int iLit )
+{
+    Cec4_Par_t * pPar = (Cec4_Par_t *)pArg;
+    Cec4_Man_t * p = pPar->pMain;
+    if ( Vec_IntSize(p->vJobs) == 0 )
+        return 0;
+    Vec_IntFillExtra( pPar->vDeps, Gia_ManObjNum(p->pNew), 0 );
+    return Cec4_ManParDepends_rec( pPar, Abc_Lit2Var(iLit), pPar->iFirst );
+}
+void Cec4_ManParQueue( void * pArg, int iObj, int iRepr, int LitRepr, int LitObj )
+{
+    Cec4_Par_t * pPar = (Cec4_Par_t *)pArg;
+    Cec4_Man_t * p = pPar->pMain;
+    Vec_IntPushTwo( p->vJobs, iObj, iRepr );
+    Vec_IntPushTwo( p->vJobs, LitRepr, LitObj );
+    if ( LitRepr == -1 )
+        return;
+    if ( Vec_IntSize(p->vJobs) == 4 || pPar->iFirst > Abc_Lit2Var(LitObj) )
+        pPar->iFirst = Abc_Lit2Var(LitObj);
+    Vec_IntFillExtra( pPar->vDeps, Gia_ManObjNum(p->pNew), 0 );
+    Vec_IntWriteEntry( pPar->vDeps, Abc_Lit2Var(LitObj), pPar->Stamp + 1 );
+}
+void Cec4_ManParStop( void * pArg )
+{
+    Cec4_Par_t * pPar = (Cec4_Par_t *)pArg;
+    Cec4_Man_t * p = pPar->pMain;
+    int i, k, status;
+    for ( i = 0; i < pPar->nProcs; i++ )
+    {
+        Cec4_ThData_t * pThData = pPar->ThData + i;
+        assert( !pThData->fWorking );
+        status = pthread_mutex_lock( &pPar->Mutex );  assert( status == 0 );
+        pThData->iStop = -1;
+        pThData->fWorking = 1;
+        status = pthread_cond_signal( &pThData->CondWork );  assert( status == 0 );
+        status = pthread_mutex_unlock( &pPar->Mutex );  assert( status == 0 );
+        status = pthread_join( pPar->WorkerThread[i], NULL );  assert( status == 0 );
+        status = pthread_cond_destroy( &pThData->CondWork );  assert( status == 0 );
+        // the statistics of the worker solvers
+        for ( k = 0; k < 2; k++ )
+        {
+            p->nConflicts[k][0] += pThData->pMan->nConflicts[k][0];
+            p->nConflicts[k][1] += pThData->pMan->nConflicts[k][1];
+            p->nConflicts[k][2]  = Abc_MaxInt( p->nConflicts[k][2], pThData->pMan->nConflicts[k][2] );
+        }
+        p->nGates[0]  += pThData->pMan->nGates[0];
+        p->nGates[1]  += pThData->pMan->nGates[1];
+        p->nRecycles  += pThData->pMan->nRecycles;
+        p->timeCnf    += pThData->pMan->timeCnf;
+        Cec4_ManParDestroyWorker( pThData->pMan );
+        Vec_IntFree( pThData->vMap );
+        Vec_IntFree( pThData->vVisited );
+        Vec_IntFree( pThData->vCiIds );
+    }
+    if ( p->pPars->fVerbose && pPar->nBatches )
+        printf( "Solved %d batches of pairs with %d threads: average = %.1f  min = %d  max = %d pairs.\n",
+            pPar->nBatches, pPar->nProcs, 1.0 * pPar->nBatchPairs / pPar->nBatches, pPar->nBatchMin, pPar->nBatchMax );
+    status = pthread_cond_destroy( &pPar->CondDone );  assert( status == 0 );
+    status = pthread_mutex_destroy( &pPar->Mutex );  assert( status == 0 );
+    Vec_IntFree( pPar->vDeps );
+    ABC_FREE( pPar );
+}
+
+#endif // pthreads are used
+
 int Cec4_ManPerformSweeping( Gia_Man_t * p, Cec_ParFra_t * pPars, Gia_Man_t ** ppNew )
 {
     Cec4_Man_t * pMan = Cec4_ManCreate( p, pPars ); 
     Gia_Obj_t * pObj, * pRepr; 
+    void * pPar = NULL;
     int i, fSimulate = 1;
     if ( pPars->fVerbose )
         printf( "Solver type = %d. Simulate %d words in %d rounds. SAT with %d confs. Recycle after %d SAT calls.\n", 
@@ -1719,14 +2227,13 @@ int Cec4_ManPerformSweeping( Gia_Man_t * p, Cec_ParFra_t * pPars, Gia_Man_t ** p
     Vec_WrdFill( p->vSimsPi, Vec_WrdSize(p->vSimsPi), 0 );
     pMan->nSatSat = 0;
     pMan->pNew = Cec4_ManStartNew( p );
+    if ( pPars->nProcs > 1 )
+        pPar = Cec4_ManParStart( pMan, pPars->nProcs );
     Gia_ManForEachAnd( p, pObj, i )
     {
         Gia_Obj_t * pObjNew; 
         pMan->nAndNodes++;
-        if ( Gia_ObjIsXor(pObj) )
-            pObj->Value = Gia_ManHashXorReal( pMan->pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
-        else
-            pObj->Value = Gia_ManHashAnd( pMan->pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+        Cec4_ManStrashNode( pMan, pObj );
         if ( pPars->nLevelMax && Gia_ObjLevel(p, pObj) > pPars->nLevelMax )
             continue;
         pObjNew = Gia_ManObj( pMan->pNew, Abc_Lit2Var(pObj->Value) );
@@ -1746,17 +2253,39 @@ int Cec4_ManPerformSweeping( Gia_Man_t * p, Cec_ParFra_t * pPars, Gia_Man_t ** p
             if ( pRepr == NULL )
                 continue;
         }
+        if ( pPar && (Cec4_ManParDepends(pPar, pObj->Value) || Cec4_ManParDepends(pPar, pRepr->Value)) )
+        {
+            // the pair may change once the queued pairs are merged
+            Cec4_ManParSolve( pPar, i );
+            Cec4_ManStrashNode( pMan, pObj );
+            if ( Gia_ObjReprObj(p, i) == NULL || (pRepr = Cec4_ManFindRepr(p, pMan, i)) == NULL )
+                continue;
+        }
         if ( Abc_Lit2Var(pObj->Value) == Abc_Lit2Var(pRepr->Value) )
         {
             assert( (pObj->Value ^ pRepr->Value) == (pObj->fPhase ^ pRepr->fPhase) );
             Gia_ObjSetProved( p, i );
             if ( Gia_ObjId(p, pRepr) == 0 )
                 pMan->iLastConst = i;
+            if ( pPar && Vec_IntSize(pMan->vJobs) ) // the batch will strash this node again
+                Cec4_ManParQueue( pPar, i, Gia_ObjId(p, pRepr), -1, -1 );
+            continue;
+        }
+        if ( pPar ) // leave the node unmerged and solve the pair later
+        {
+            Cec4_ManParQueue( pPar, i, Gia_ObjId(p, pRepr), pRepr->Value, pObj->Value );
+            if ( Cec4_ManParFull(pPar) )
+                Cec4_ManParSolve( pPar, i+1 );
             continue;
         }
         if ( Cec4_ManSweepNode(pMan, i, Gia_ObjId(p, pRepr)) && Gia_ObjProved(p, i) )
             pObj->Value = Abc_LitNotCond( pRepr->Value, pObj->fPhase ^ pRepr->fPhase );
     }
+    if ( pPar )
+    {
+        Cec4_ManParSolve( pPar, Gia_ManObjNum(p) );
+        Cec4_ManParStop( pPar );
+    }
     if ( p->iPatsPi > 0 )
     {
         abctime clk2 = Abc_Clock();
@@ -23,6 +23,7 @@
 #include "aig/gia/giaAig.h"
 #include "sat/cnf/cnf.h"
 #include "sat/bsat/satSolver.h"
+#include "sat/bsat/satShare.h"
 #include "misc/util/utilTruth.h"
 //#include "bdd/cudd/cuddInt.h"
 
@@ -47,6 +48,11 @@ ABC_NAMESPACE_IMPL_START
 #ifndef ABC_USE_PTHREADS
 
 int Cec_GiaSplitTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int LookAhead, int fVerbose, int fVeryVerbose, int fSilent ) { return -1; }
+int Cec_GiaPortfolioTest( Gia_Man_t * p, int nProcs, int nTimeOut, int fShare, int nShareSize, int nShareLbd, int fVerbose, int fSilent ) 
+{ 
+    printf( "The portfolio of SAT solvers requires ABC to be compiled with pthreads.\n" ); 
+    return -1; 
+}
 
 #else // pthreads are used
 
@@ -704,8 +710,7 @@ int Cec_GiaSplitTestInt( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax,
 finish:
     // wait till threads finish
     for ( i = 0; i < nProcs; i++ )
-        if ( ThData[i].fWorking )
-            i = 0;
+        while ( *(volatile int *)&ThData[i].fWorking );
     // stop threads
     for ( i = 0; i < nProcs; i++ )
     {
@@ -768,6 +773,167 @@ int Cec_GiaSplitTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int
     return RetValue;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Portfolio of SAT solvers exchanging learned clauses.]
+
+  Description [All workers solve the same CNF with different random seeds
+  and initial polarities. Since the CNF is the same, a clause learned by one
+  worker is implied for all of them, so short clauses with low LBD are
+  published on a lock-free bus and imported by the others at restarts.
+  (Cube-and-conquer above cannot do this: every cube is a different
+  cofactored AIG with its own CNF numbering.) The first answer stops
+  the remaining workers.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Par_PortData_t_
+{
+    Gia_Man_t *   p;
+    Cnf_Dat_t *   pCnf;
+    Sat_Share_t * pShare;
+    int           iThread;
+    int           nTimeOut;
+    int           nShareSize;
+    int           nShareLbd;
+    int           Result;
+    int           nConfs;
+    Abc_Cex_t *   pCex;
+    volatile int * pStop;      // shared by the workers of one run, the first answer sets it
+} Par_PortData_t;
+void * Cec_GiaPortfolioWorkerThread( void * pArg )
+{
+    Par_PortData_t * pThData = (Par_PortData_t *)pArg;
+    sat_solver * pSat = Cec_GiaDeriveSolver( pThData->p, pThData->pCnf, pThData->nTimeOut );
+    int v, status;
+    if ( pSat == NULL )
+    {
+        pThData->Result = 1;
+        *pThData->pStop = 1;
+        return NULL;
+    }
+    // diversify the workers (worker 0 runs the default configuration)
+    if ( pThData->iThread > 0 )
+        pSat->random_seed = 91648253 + 7919 * pThData->iThread;
+    if ( pThData->iThread & 1 )
+        for ( v = 0; v < sat_solver_nvars(pSat); v++ )
+            pSat->polarity[v] = 1;
+    if ( pThData->iThread & 2 )
+        pSat->nLearntStart = pSat->nLearntMax = 2 * pSat->nLearntStart;
+    if ( pThData->pShare )
+        sat_solver_set_share( pSat, pThData->pShare, pThData->iThread, pThData->nShareSize, pThData->nShareLbd );
+    sat_solver_set_stop_flag( pSat, pThData->pStop );
+    status = sat_solver_solve( pSat, NULL, NULL, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0 );
+    pThData->nConfs = sat_solver_nconflicts( pSat );
+    if ( status == l_True )
+        pThData->pCex = Cec_SplitDeriveModel( pThData->p, pThData->pCnf, pSat );
+    pThData->Result = status == l_True ? 0 : (status == l_False ? 1 : -1);
+    if ( pThData->Result != -1 )
+        *pThData->pStop = 1;
+    sat_solver_delete( pSat );
+    return NULL;
+}
+int Cec_GiaPortfolioTestInt( Gia_Man_t * p, int nProcs, int nTimeOut, int fShare, int nShareSize, int nShareLbd, int fVerbose )
+{
+    Par_PortData_t ThData[PAR_THR_MAX];
+    pthread_t WorkerThread[PAR_THR_MAX];
+    Sat_Share_t * pShare = fShare ? Sat_ShareStart( nProcs, 20 ) : NULL;
+    Cnf_Dat_t * pCnf = Cec_GiaDeriveGiaRemapped( p );
+    volatile int fStop = 0;
+    int i, status, RetValue = -1;
+    assert( nProcs >= 1 && nProcs <= PAR_THR_MAX );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        memset( ThData + i, 0, sizeof(Par_PortData_t) );
+        ThData[i].p          = p;
+        ThData[i].pCnf       = pCnf;
+        ThData[i].pShare     = pShare;
+        ThData[i].iThread    = i;
+        ThData[i].nTimeOut   = nTimeOut;
+        ThData[i].nShareSize = nShareSize;
+        ThData[i].nShareLbd  = nShareLbd;
+        ThData[i].Result     = -1;
+        ThData[i].pStop      = &fStop;
+        status = pthread_create( WorkerThread + i, NULL, Cec_GiaPortfolioWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+    }
+    for ( i = 0; i < nProcs; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+    }
+    for ( i = 0; i < nProcs; i++ )
+    {
+        if ( fVerbose )
+        {
+            int nExp = 0, nImp = 0, nDrop = 0;
+            if ( pShare )
+                Sat_ShareStats( pShare, i, &nExp, &nImp, &nDrop );
+            printf( "Worker %2d : %-9s  Conf =%9d   Exported =%8d   Imported =%8d   Dropped =%5d\n", i,
+                ThData[i].Result == -1 ? "UNDECIDED" : (ThData[i].Result ? "UNSAT" : "SAT"), ThData[i].nConfs, nExp, nImp, nDrop );
+        }
+        if ( ThData[i].Result != -1 )
+        {
+            assert( RetValue == -1 || RetValue == ThData[i].Result );
+            RetValue = ThData[i].Result;
+        }
+        if ( ThData[i].pCex && p->pCexComb == NULL )
+            p->pCexComb = ThData[i].pCex;
+        else if ( ThData[i].pCex )
+            Abc_CexFree( ThData[i].pCex );
+    }
+    Cnf_DataFree( pCnf );
+    if ( pShare )
+        Sat_ShareStop( pShare );
+    return RetValue;
+}
+int Cec_GiaPortfolioTest( Gia_Man_t * p, int nProcs, int nTimeOut, int fShare, int nShareSize, int nShareLbd, int fVerbose, int fSilent )
+{
+    abctime clkTotal = Abc_ClockWall();
+    Abc_Cex_t * pCex = NULL;
+    Gia_Man_t * pOne;
+    Gia_Obj_t * pObj;
+    int i, RetValue1, fOneUndef = 0, RetValue = -1;
+    Abc_CexFreeP( &p->pCexComb );
+    if ( fVerbose )
+        printf( "Solving by a portfolio of %d solvers with clause sharing %s (max size = %d, max LBD = %d).\n", 
+            nProcs, fShare ? "enabled" : "disabled", nShareSize, nShareLbd );
+    Gia_ManForEachPo( p, pObj, i )
+    {
+        pOne = Gia_ManDupOutputGroup( p, i, i+1 );
+        if ( fVerbose && Gia_ManPoNum(p) > 1 )
+            printf( "Solving output %d:\n", i );
+        RetValue1 = Cec_GiaPortfolioTestInt( pOne, nProcs, nTimeOut, fShare, nShareSize, nShareLbd, fVerbose );
+        if ( RetValue1 == 0 && RetValue == -1 )
+        {
+            pCex = pOne->pCexComb; pOne->pCexComb = NULL;
+            pCex->iPo = i;
+            RetValue = 0;
+        }
+        Gia_ManStop( pOne );
+        if ( RetValue1 == -1 )
+            fOneUndef = 1;
+    }
+    if ( RetValue == -1 )
+        RetValue = fOneUndef ? -1 : 1;
+    else
+        p->pCexComb = pCex;
+    if ( !fSilent )
+    {
+        if ( RetValue == 0 )
+            printf( "Problem is SAT " );
+        else if ( RetValue == 1 )
+            printf( "Problem is UNSAT " );
+        else
+            printf( "Problem is UNDECIDED " );
+        printf( "using %d solvers %s clause sharing.  ", nProcs, fShare ? "with" : "without" );
+        Abc_PrintTime( 1, "Time", Abc_ClockWall() - clkTotal );
+        fflush( stdout );
+    }
+    return RetValue;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Print stats about cofactoring variables.]
@@ -0,0 +1,226 @@
+/**CFile****************************************************************
+
+  FileName    [satShare.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [SAT solver.]
+
+  Synopsis    [Lock-free exchange of learned clauses among solver threads.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: satShare.c,v 1.00 2026/10/17 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#include "satShare.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+typedef struct Sat_Ring_t_ Sat_Ring_t;
+struct Sat_Ring_t_
+{
+    volatile word   Head;         // the number of words ever written (owner only)
+    int *           pData;        // the circular buffer
+    int             nExported;    // clauses written by the owner
+    int             nImported;    // clauses read by the owner from other rings
+    int             nDropped;     // batches lost by the owner because of overruns
+    word            Pad[4];       // keeps the rings on separate cache lines
+};
+
+struct Sat_Share_t_
+{
+    int             nWorkers;     // the number of workers
+    int             nRingSize;    // the number of words in each ring
+    Sat_Ring_t *    pRings;       // one ring per worker
+    word *          pCursors;     // read positions (reader x writer)
+};
+
+static inline word Sat_ShareLoadAcquire( volatile word * pHead )
+{
+#if defined(__GNUC__)
+    return __atomic_load_n( pHead, __ATOMIC_ACQUIRE );
+#else
+    return *pHead;
+#endif
+}
+static inline void Sat_ShareStoreRelease( volatile word * pHead, word Value )
+{
+#if defined(__GNUC__)
+    __atomic_store_n( pHead, Value, __ATOMIC_RELEASE );
+#else
+    *pHead = Value;
+#endif
+}
+static inline void Sat_ShareFenceAcquire()
+{
+#if defined(__GNUC__)
+    __atomic_thread_fence( __ATOMIC_ACQUIRE );
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the bus.]
+
+  Description [Each of the nWorkers rings holds 2^nRingLog literals.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Sat_Share_t * Sat_ShareStart( int nWorkers, int nRingLog )
+{
+    Sat_Share_t * p;
+    int i;
+    assert( nWorkers > 0 && nRingLog >= 8 && nRingLog < 30 );
+    p = ABC_CALLOC( Sat_Share_t, 1 );
+    p->nWorkers  = nWorkers;
+    p->nRingSize = 1 << nRingLog;
+    p->pRings    = ABC_CALLOC( Sat_Ring_t, nWorkers );
+    p->pCursors  = ABC_CALLOC( word, nWorkers * nWorkers );
+    for ( i = 0; i < nWorkers; i++ )
+        p->pRings[i].pData = ABC_CALLOC( int, p->nRingSize );
+    return p;
+}
+void Sat_ShareStop( Sat_Share_t * p )
+{
+    int i;
+    for ( i = 0; i < p->nWorkers; i++ )
+        ABC_FREE( p->pRings[i].pData );
+    ABC_FREE( p->pRings );
+    ABC_FREE( p->pCursors );
+    ABC_FREE( p );
+}
+int Sat_ShareWorkerNum( Sat_Share_t * p )
+{
+    return p->nWorkers;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Publishes one clause of the given worker.]
+
+  Description [Must only be called by the owner of the ring.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Sat_ShareExport( Sat_Share_t * p, int iWorker, int * pLits, int nLits )
+{
+    Sat_Ring_t * pRing = p->pRings + iWorker;
+    word Head = pRing->Head;
+    int i, Mask = p->nRingSize - 1;
+    assert( iWorker >= 0 && iWorker < p->nWorkers );
+    assert( nLits > 0 && 2 * (nLits + 1) <= p->nRingSize );
+    pRing->pData[Head++ & Mask] = nLits;
+    for ( i = 0; i < nLits; i++ )
+        pRing->pData[Head++ & Mask] = pLits[i];
+    Sat_ShareStoreRelease( &pRing->Head, Head );
+    pRing->nExported++;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Collects the clauses published by other workers.]
+
+  Description [Appends the clauses to vClauses as <size, lits...> records
+  and returns their number. A ring is only trusted while its writer is
+  less than half a ring ahead of the cursor: the other half may be under
+  construction. If the writer got further than that before or during the
+  copy, the batch is dropped and the cursor catches up with the head.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Sat_ShareImport( Sat_Share_t * p, int iWorker, veci * vClauses )
+{
+    word Limit = (word)(p->nRingSize / 2);
+    int w, k, Mask = p->nRingSize - 1, nClauses = 0;
+    assert( iWorker >= 0 && iWorker < p->nWorkers );
+    veci_resize( vClauses, 0 );
+    for ( w = 0; w < p->nWorkers; w++ )
+    {
+        Sat_Ring_t * pRing = p->pRings + w;
+        word * pCursor = p->pCursors + iWorker * p->nWorkers + w;
+        word Tail = *pCursor, Head, Head2, i;
+        int Start = veci_size( vClauses );
+        if ( w == iWorker )
+            continue;
+        Head = Sat_ShareLoadAcquire( &pRing->Head );
+        if ( Head == Tail )
+            continue;
+        if ( Head - Tail > Limit )
+        {
+            p->pRings[iWorker].nDropped++;
+            *pCursor = Head;
+            continue;
+        }
+        for ( i = Tail; i < Head; i++ )
+            veci_push( vClauses, ((volatile int *)pRing->pData)[i & Mask] );
+        Sat_ShareFenceAcquire();
+        Head2 = Sat_ShareLoadAcquire( &pRing->Head );
+        if ( Head2 - Tail > Limit )
+        {
+            p->pRings[iWorker].nDropped++;
+            veci_resize( vClauses, Start );
+            *pCursor = Head2;
+            continue;
+        }
+        *pCursor = Head;
+        for ( k = Start; k < veci_size(vClauses); k += veci_begin(vClauses)[k] + 1 )
+            nClauses++;
+    }
+    p->pRings[iWorker].nImported += nClauses;
+    return nClauses;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the traffic counters of one worker.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Sat_ShareStats( Sat_Share_t * p, int iWorker, int * pnExported, int * pnImported, int * pnDropped )
+{
+    Sat_Ring_t * pRing = p->pRings + iWorker;
+    if ( pnExported ) *pnExported = pRing->nExported;
+    if ( pnImported ) *pnImported = pRing->nImported;
+    if ( pnDropped )  *pnDropped  = pRing->nDropped;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
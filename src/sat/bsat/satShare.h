@@ -0,0 +1,71 @@
+/**CFile****************************************************************
+
+  FileName    [satShare.h]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [SAT solver.]
+
+  Synopsis    [Lock-free exchange of learned clauses among solver threads.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: satShare.h,v 1.00 2026/10/17 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#ifndef ABC__sat__bsat__satShare_h
+#define ABC__sat__bsat__satShare_h
+
+/*
+    The bus has one ring buffer per worker. Only the owner writes its ring:
+    it stores the clause as <size, lit_0, ..., lit_size-1> and then publishes
+    the new head with a release store. Every other worker keeps a private
+    cursor into each ring. A reader copies the words between its cursor and
+    the head, then re-reads the head; if the writer has lapped the cursor in
+    the meantime, the copied words are discarded and the cursor jumps to
+    the head. Nobody ever waits: a slow reader loses clauses, never time.
+    Clauses are only valid for solvers that were loaded with the same CNF.
+*/
+
+////////////////////////////////////////////////////////////////////////
+///                          INCLUDES                                ///
+////////////////////////////////////////////////////////////////////////
+
+#include "satVec.h"
+
+////////////////////////////////////////////////////////////////////////
+///                         PARAMETERS                               ///
+////////////////////////////////////////////////////////////////////////
+
+ABC_NAMESPACE_HEADER_START
+
+////////////////////////////////////////////////////////////////////////
+///                         BASIC TYPES                              ///
+////////////////////////////////////////////////////////////////////////
+
+typedef struct Sat_Share_t_ Sat_Share_t;
+
+////////////////////////////////////////////////////////////////////////
+///                    FUNCTION DECLARATIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/*=== satShare.c ==========================================================*/
+extern Sat_Share_t * Sat_ShareStart( int nWorkers, int nRingLog );
+extern void          Sat_ShareStop( Sat_Share_t * p );
+extern int           Sat_ShareWorkerNum( Sat_Share_t * p );
+extern void          Sat_ShareExport( Sat_Share_t * p, int iWorker, int * pLits, int nLits );
+extern int           Sat_ShareImport( Sat_Share_t * p, int iWorker, veci * vClauses );
+extern void          Sat_ShareStats( Sat_Share_t * p, int iWorker, int * pnExported, int * pnImported, int * pnDropped );
+
+ABC_NAMESPACE_HEADER_END
+
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
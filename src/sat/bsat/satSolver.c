@@ -26,6 +26,7 @@ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWA
 
 #include "satSolver.h"
 #include "satStore.h"
+#include "satShare.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -132,6 +133,18 @@ int sat_solver_get_var_value(sat_solver* s, int v)
 static inline int      sat_solver_dl(sat_solver* s)                { return veci_size(&s->trail_lim); }
 static inline veci*    sat_solver_read_wlist(sat_solver* s, lit l) { return &s->wlists[l];            }
 
+// Watch lists mix two kinds of entries. A binary clause takes one odd word
+// (clause_from_lit() of the other literal). A longer clause takes two words:
+// its even handle and a blocker literal; if the blocker is true, the clause
+// is satisfied and propagation skips it without touching clause memory.
+static inline void     sat_solver_watch(sat_solver* s, lit l, cla h, lit blocker)
+{
+    veci* ws = sat_solver_read_wlist(s,l);
+    assert( !clause_is_lit(h) );
+    veci_push(ws,h);
+    veci_push(ws,blocker);
+}
+
 //=================================================================================================
 // Variable order functions:
 
@@ -539,11 +552,14 @@ int sat_solver_clause_new(sat_solver* s, lit* begin, lit* end, int learnt)
     assert(learnt >= 0 && learnt < 2);
     size           = end - begin;
 
-    // do not allocate memory for the two-literal problem clause
-    if ( fUseBinaryClauses && size == 2 && !learnt )
+    // do not allocate memory for the two-literal clause
+    // (learned ones too, unless rollback may have to remove them later)
+    if ( fUseBinaryClauses && size == 2 && (!learnt || s->iVarPivot == 0) )
     {
         veci_push(sat_solver_read_wlist(s,lit_neg(begin[0])),(clause_from_lit(begin[1])));
         veci_push(sat_solver_read_wlist(s,lit_neg(begin[1])),(clause_from_lit(begin[0])));
+        if ( learnt )
+            return 0;
         s->stats.clauses++;
         s->stats.clauses_literals += size;
         return 0;
@@ -583,10 +599,9 @@ int sat_solver_clause_new(sat_solver* s, lit* begin, lit* end, int learnt)
     assert(lit_neg(begin[0]) < s->size*2);
     assert(lit_neg(begin[1]) < s->size*2);
 
-    //veci_push(sat_solver_read_wlist(s,lit_neg(begin[0])),c);
-    //veci_push(sat_solver_read_wlist(s,lit_neg(begin[1])),c);
-    veci_push(sat_solver_read_wlist(s,lit_neg(begin[0])),(size > 2 ? h : clause_from_lit(begin[1])));
-    veci_push(sat_solver_read_wlist(s,lit_neg(begin[1])),(size > 2 ? h : clause_from_lit(begin[0])));
+    // each watcher is the clause handle followed by a blocker literal
+    sat_solver_watch(s, lit_neg(begin[0]), h, begin[1]);
+    sat_solver_watch(s, lit_neg(begin[1]), h, begin[0]);
 
     return h;
 }
@@ -716,11 +731,18 @@ static void sat_solver_record(sat_solver* s, veci* cls)
     lit*    begin = veci_begin(cls);
     lit*    end   = begin + veci_size(cls);
     int     h     = (veci_size(cls) > 1) ? sat_solver_clause_new(s,begin,end,1) : 0;
-    sat_solver_enqueue(s,*begin,h);
     assert(veci_size(cls) > 0);
+    // the binary clause was added to the watch lists only
+    if ( h == 0 && veci_size(cls) == 2 )
+        h = clause_from_lit(lit_neg(begin[1]));
+    sat_solver_enqueue(s,*begin,h);
     if ( h == 0 )
         veci_push( &s->unit_lits, *begin );
 
+    // publish short clauses with few decision levels
+    if ( s->pShare && veci_size(cls) <= s->nShareSize && (clause_is_lit(h) || h == 0 || (int)clause_read(s, h)->lbd <= s->nShareLbd) )
+        Sat_ShareExport( (Sat_Share_t *)s->pShare, s->iShareId, begin, veci_size(cls) );
+
     ///////////////////////////////////
     // add clause to internal storage
     if ( s->pStore )
@@ -1075,9 +1097,20 @@ int sat_solver_propagate(sat_solver* s)
                     while (i < end)
                         *j++ = *i++;
                 }
+                else
+                    i++;
             }else{
+                clause* c;
+                lit blocker = i[1];
+
+                // If the blocker is true, then clause is already satisfied.
+                if (var_value(s, lit_var(blocker)) == lit_sign(blocker)){
+                    *j++ = *i++;
+                    *j++ = *i++;
+                    continue;
+                }
 
-                clause* c = clause_read(s,*i);
+                c = clause_read(s,*i);
                 lits = clause_begin(c);
 
                 // Make sure the false literal is data[1]:
@@ -1089,8 +1122,10 @@ int sat_solver_propagate(sat_solver* s)
                 assert(lits[1] == false_lit);
 
                 // If 0th watch is true, then clause is already satisfied.
-                if (var_value(s, lit_var(lits[0])) == lit_sign(lits[0]))
+                if (var_value(s, lit_var(lits[0])) == lit_sign(lits[0])){
                     *j++ = *i;
+                    *j++ = lits[0];
+                }
                 else{
                     // Look for new watch:
                     lit* stop = lits + clause_size(c);
@@ -1099,24 +1134,27 @@ int sat_solver_propagate(sat_solver* s)
                         if (var_value(s, lit_var(*k)) != !lit_sign(*k)){
                             lits[1] = *k;
                             *k = false_lit;
-                            veci_push(sat_solver_read_wlist(s,lit_neg(lits[1])),*i);
+                            sat_solver_watch(s,lit_neg(lits[1]),*i,lits[0]);
                             goto next; }
                     }
 
                     *j++ = *i;
+                    *j++ = lits[0];
                     // Clause is unit under assignment:
                     if ( c->lrn )
                         c->lbd = sat_clause_compute_lbd(s, c);
                     if (!sat_solver_enqueue(s,lits[0], *i)){
-                        hConfl = *i++;
+                        hConfl = *i;
+                        i += 2;
                         // Copy the remaining watches:
                         while (i < end)
                             *j++ = *i++;
+                        continue;
                     }
                 }
+            next:
+                i += 2;
             }
-        next:
-            i++;
         }
 
         s->stats.inspects += j - veci_begin(ws);
@@ -1357,6 +1395,7 @@ void sat_solver_delete(sat_solver* s)
 
     veci_delete(&s->user_vars);
     veci_delete(&s->user_values);
+    veci_delete(&s->share_buf);
 
     // delete arrays
     if (s->reasons != 0){
@@ -1384,6 +1423,18 @@ void sat_solver_delete(sat_solver* s)
     ABC_FREE(s);
 }
 
+// connects the solver to a clause exchange bus (pShare == NULL disconnects it)
+void sat_solver_set_share( sat_solver* s, void * pShare, int iShareId, int nShareSize, int nShareLbd )
+{
+    assert( pShare == NULL || (iShareId >= 0 && iShareId < Sat_ShareWorkerNum((Sat_Share_t *)pShare)) );
+    if ( s->share_buf.ptr == NULL )
+        veci_new(&s->share_buf);
+    s->pShare     = pShare;
+    s->iShareId   = iShareId;
+    s->nShareSize = nShareSize;
+    s->nShareLbd  = nShareLbd;
+}
+
 void sat_solver_restart( sat_solver* s )
 {
     int i;
@@ -1611,12 +1662,18 @@ void sat_solver_reducedb(sat_solver* s)
             if ( clause_is_lit(pArray[k]) ) // 2-lit clause
                 pArray[j++] = pArray[k];
             else if ( !clause_learnt_h(pMem, pArray[k]) ) // problem clause
+            {
                 pArray[j++] = pArray[k];
+                pArray[j++] = pArray[++k]; // blocker
+            }
             else 
             {
-                c = clause_read(s, pArray[k]);
+                c = clause_read(s, pArray[k++]);
                 if ( !c->mark ) // useful learned clause
+                {
                    pArray[j++] = clause_id(c); // updating handle here!!!
+                   pArray[j++] = pArray[k]; // blocker
+                }
             }
         }
         veci_resize(&s->wlists[i],j);
@@ -1678,7 +1735,12 @@ void sat_solver_rollback( sat_solver* s )
                     pArray[j++] = pArray[k];
             }
             else if ( Sat_MemClauseUsed(pMem, pArray[k]) )
+            {
                 pArray[j++] = pArray[k];
+                pArray[j++] = pArray[++k]; // blocker
+            }
+            else
+                k++;
         }
         veci_resize(&s->wlists[i],j);
     }
@@ -1936,6 +1998,42 @@ static lbool sat_solver_search(sat_solver* s, ABC_INT64_T nof_conflicts)
     return l_Undef; // cannot happen
 }
 
+// adds the clauses learned by other solvers on the bus (at decision level 0)
+static lbool sat_solver_import(sat_solver* s)
+{
+    veci* v = &s->share_buf;
+    int   k, i, j, nLits;
+    assert(sat_solver_dl(s) == 0);
+    if ( Sat_ShareImport( (Sat_Share_t *)s->pShare, s->iShareId, v ) == 0 )
+        return l_Undef;
+    for ( k = 0; k < veci_size(v); k += nLits + 1 )
+    {
+        lit* pLits = veci_begin(v) + k + 1;
+        nLits = pLits[-1];
+        // skip satisfied clauses and remove false literals
+        for ( i = j = 0; i < nLits; i++ )
+        {
+            assert( lit_var(pLits[i]) < s->size );
+            if ( var_value(s, lit_var(pLits[i])) == varX )
+                pLits[j++] = pLits[i];
+            else if ( var_value(s, lit_var(pLits[i])) == lit_sign(pLits[i]) )
+                break;
+        }
+        if ( i < nLits )
+            continue;
+        if ( j == 0 )
+            return l_False;
+        if ( j == 1 )
+        {
+            sat_solver_enqueue(s, pLits[0], 0);
+            veci_push(&s->unit_lits, pLits[0]);
+        }
+        else
+            sat_solver_clause_new(s, pLits, pLits + j, 1);
+    }
+    return sat_solver_propagate(s) ? l_False : l_Undef;
+}
+
 // internal call to the SAT solver
 int sat_solver_solve_internal(sat_solver* s)
 {
@@ -1971,6 +2069,8 @@ int sat_solver_solve_internal(sat_solver* s)
             fflush(stdout);
         }
         nof_conflicts = (ABC_INT64_T)( 100 * luby(2, restart_iter++) );
+        if ( s->pShare && s->pStore == NULL && s->root_level == 0 && (status = sat_solver_import(s)) == l_False )
+            break;
         status = sat_solver_search(s, nof_conflicts);
         // quit the loop if reached an external limit
         if ( s->nConfLimit && s->stats.conflicts > s->nConfLimit )
@@ -1981,6 +2081,8 @@ int sat_solver_solve_internal(sat_solver* s)
             break;
         if ( s->pFuncStop && s->pFuncStop(s->RunId) )
             break;
+        if ( s->pStop && *s->pStop )
+            break;
     }
     if (s->verbosity >= 1)
         printf("==============================================================================\n");
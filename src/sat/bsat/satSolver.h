@@ -58,6 +58,7 @@ extern void        sat_solver_set_resource_limits(sat_solver* s, ABC_INT64_T nCo
 extern void        sat_solver_restart( sat_solver* s );
 extern void        zsat_solver_restart_seed( sat_solver* s, double seed );
 extern void        sat_solver_rollback( sat_solver* s );
+extern void        sat_solver_set_share( sat_solver* s, void * pShare, int iShareId, int nShareSize, int nShareLbd );
 
 extern int         sat_solver_nvars(sat_solver* s);
 extern int         sat_solver_nclauses(sat_solver* s);
@@ -206,6 +207,14 @@ struct sat_solver_t
     // termination callback
     int         RunId;          // SAT id in this run
     int(*pFuncStop)(int);       // callback to terminate
+    volatile int * pStop;       // flag set by another thread to terminate
+
+    // learned clause exchange
+    void *      pShare;         // the bus shared with other solvers (Sat_Share_t)
+    int         iShareId;       // the index of this solver on the bus
+    int         nShareSize;     // the largest clause exported
+    int         nShareLbd;      // the largest LBD of a clause exported
+    veci        share_buf;      // clauses imported at the last restart
 };
 
 static inline clause * clause_read( sat_solver * s, cla h )          
@@ -343,6 +352,10 @@ static inline void sat_solver_set_stop_func( sat_solver *s, int (*fnct)(int) )
 { 
     s->pFuncStop = fnct; 
 }
+static inline void sat_solver_set_stop_flag( sat_solver *s, volatile int * pStop ) 
+{ 
+    s->pStop = pStop; 
+}
 
 static inline int sat_solver_add_const( sat_solver * pSat, int iVar, int fCompl )
 {
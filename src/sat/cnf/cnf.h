@@ -51,6 +51,10 @@ ABC_NAMESPACE_HEADER_START
 typedef struct Cnf_Man_t_            Cnf_Man_t;
 typedef struct Cnf_Dat_t_            Cnf_Dat_t;
 typedef struct Cnf_Cut_t_            Cnf_Cut_t;
+typedef struct Cnf_Inc_t_            Cnf_Inc_t;
+
+// the incremental manager works on a GIA, which this header does not include
+struct Gia_Man_t_;
 
 // the CNF asserting outputs of AIG to be 1
 struct Cnf_Dat_t_
@@ -148,6 +152,17 @@ extern void            Cnf_ComputeClauses( Aig_Man_t * p, Aig_Obj_t * pRoot, Vec
                            Vec_Ptr_t * vNodes, Vec_Int_t * vMap, Vec_Int_t * vCover, Vec_Int_t * vClauses );
 extern void            Cnf_DeriveFastMark( Aig_Man_t * p );
 extern Cnf_Dat_t *     Cnf_DeriveFast( Aig_Man_t * p, int nOutputs );
+/*=== cnfInc.c ========================================================*/
+extern Cnf_Inc_t *     Cnf_IncStart( struct Gia_Man_t_ * pGia, Cnf_Dat_t * pCnf );
+extern void            Cnf_IncStop( Cnf_Inc_t * p );
+extern void            Cnf_IncRestart( Cnf_Inc_t * p );
+extern void *          Cnf_IncSolver( Cnf_Inc_t * p );
+extern int             Cnf_IncLoadedNum( Cnf_Inc_t * p );
+extern int             Cnf_IncClauseNum( Cnf_Inc_t * p );
+extern int             Cnf_IncObjVar( Cnf_Inc_t * p, int iObj, int iCopy );
+extern int             Cnf_IncAddVars( Cnf_Inc_t * p, int nVars );
+extern int             Cnf_IncLoadObj( Cnf_Inc_t * p, int iObj, int iCopy );
+extern int             Cnf_IncLoadLit( Cnf_Inc_t * p, int iLit, int iCopy );
 /*=== cnfMan.c ========================================================*/
 extern Cnf_Man_t *     Cnf_ManStart();
 extern void            Cnf_ManStop( Cnf_Man_t * p );
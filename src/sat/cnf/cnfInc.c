@@ -0,0 +1,275 @@
+/**CFile****************************************************************
+
+  FileName    [cnfInc.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [AIG-to-CNF conversion.]
+
+  Synopsis    [Incremental loading of GIA cones into a live SAT solver.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: cnfInc.c,v 1.00 2026/10/17 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "cnf.h"
+#include "aig/gia/gia.h"
+#include "sat/bsat/satSolver.h"
+
+ABC_NAMESPACE_IMPL_START
+
+/*
+    The manager keeps one SAT solver and encodes the GIA into it on demand.
+    Loading a literal adds the clauses of the part of its TFI that is not
+    encoded yet, so the logic shared by several queries is encoded once and
+    nothing outside the requested cones is ever derived or copied.
+
+    Any number of independent copies of the GIA can be loaded into the same
+    solver. Copy k plays the role of the CNF lifted by k * nVars with
+    Cnf_DataLift(), except that its variables are allocated only for the
+    objects that are actually reached.
+
+    The clauses of an object come from the cut-based CNF given at the start,
+    which must use object IDs as variables (Mf_ManGenerateCnf() with
+    fCnfObjIds set). This CNF is only read and can be shared by managers
+    working in different threads. Without it, and for AND nodes that are not
+    roots of its mapping, the usual three AND-gate clauses are used.
+*/
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+struct Cnf_Inc_t_
+{
+    Gia_Man_t *     pGia;         // the AIG (only read)
+    Cnf_Dat_t *     pCnf;         // the cut-based CNF with object IDs as variables or NULL (only read)
+    sat_solver *    pSat;         // the solver
+    int             nObjs;        // the number of objects in the AIG
+    int             nSatVars;     // the number of solver variables used
+    Vec_Int_t *     vObj2Var;     // the variable of each object in each copy (iCopy * nObjs + iObj)
+    Vec_Int_t *     vLoaded;      // the entries of vObj2Var set since the last restart
+    Vec_Int_t *     vLits;        // temporary clause
+    int             nClauses;     // the number of clauses added since the last restart
+};
+
+static inline int * Cnf_IncObj2Var( Cnf_Inc_t * p, int iCopy ) { return Vec_IntEntryP( p->vObj2Var, iCopy * p->nObjs ); }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the manager with an empty solver.]
+
+  Description [The CNF is optional. When given, it should be derived by
+  Mf_ManGenerateCnf() with object IDs as variables and stay alive as long
+  as the manager does.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Cnf_Inc_t * Cnf_IncStart( Gia_Man_t * pGia, Cnf_Dat_t * pCnf )
+{
+    Cnf_Inc_t * p;
+    assert( pCnf == NULL || pCnf->pObj2Clause != NULL );
+    p = ABC_CALLOC( Cnf_Inc_t, 1 );
+    p->pGia     = pGia;
+    p->pCnf     = pCnf;
+    p->pSat     = sat_solver_new();
+    p->nObjs    = Gia_ManObjNum( pGia );
+    p->vObj2Var = Vec_IntStartFull( p->nObjs );
+    p->vLoaded  = Vec_IntAlloc( 1000 );
+    p->vLits    = Vec_IntAlloc( 100 );
+    return p;
+}
+void Cnf_IncStop( Cnf_Inc_t * p )
+{
+    sat_solver_delete( p->pSat );
+    Vec_IntFree( p->vObj2Var );
+    Vec_IntFree( p->vLoaded );
+    Vec_IntFree( p->vLits );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Forgets the loaded objects and empties the solver.]
+
+  Description [Takes time linear in what was loaded, not in the AIG size.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cnf_IncRestart( Cnf_Inc_t * p )
+{
+    int i, Entry;
+    Vec_IntForEachEntry( p->vLoaded, Entry, i )
+        Vec_IntWriteEntry( p->vObj2Var, Entry, -1 );
+    Vec_IntClear( p->vLoaded );
+    p->nSatVars = 0;
+    p->nClauses = 0;
+    sat_solver_restart( p->pSat );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Simple access.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Cnf_IncSolver( Cnf_Inc_t * p )
+{
+    return p->pSat;
+}
+int Cnf_IncLoadedNum( Cnf_Inc_t * p )
+{
+    return Vec_IntSize( p->vLoaded );
+}
+int Cnf_IncClauseNum( Cnf_Inc_t * p )
+{
+    return p->nClauses;
+}
+int Cnf_IncObjVar( Cnf_Inc_t * p, int iObj, int iCopy )
+{
+    assert( iObj >= 0 && iObj < p->nObjs && iCopy >= 0 );
+    if ( (iCopy + 1) * p->nObjs > Vec_IntSize(p->vObj2Var) )
+        return -1;
+    return Cnf_IncObj2Var(p, iCopy)[iObj];
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Allocates variables that are not related to the AIG.]
+
+  Description [Returns the first of nVars new variables. They are freed
+  by the restart together with the loaded objects.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cnf_IncAddVars( Cnf_Inc_t * p, int nVars )
+{
+    int iVar = p->nSatVars;
+    p->nSatVars += nVars;
+    sat_solver_setnvars( p->pSat, p->nSatVars );
+    return iVar;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Loads the part of the TFI of the object that is not loaded.]
+
+  Description [Returns the variable of the object in the given copy.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Cnf_IncAddClause( Cnf_Inc_t * p )
+{
+    sat_solver_addclause( p->pSat, Vec_IntArray(p->vLits), Vec_IntLimit(p->vLits) );
+    p->nClauses++;
+}
+static int Cnf_IncLoadObj_rec( Cnf_Inc_t * p, int iObj, int iCopy )
+{
+    Cnf_Dat_t * pCnf = p->pCnf;
+    Gia_Obj_t * pObj;
+    int * pLit, * pObj2Var, iVar, iVar0, iVar1, c, iBeg, iEnd;
+    if ( (iVar = Cnf_IncObj2Var(p, iCopy)[iObj]) >= 0 )
+        return iVar;
+    pObj = Gia_ManObj( p->pGia, iObj );
+    if ( Gia_ObjIsCi(pObj) )
+        iVar = Cnf_IncAddVars( p, 1 );
+    else if ( pCnf && pCnf->pObj2Count[iObj] > 0 )
+    {
+        // the clauses of the object are the ones of its cut, the first literal is the object
+        iBeg = pCnf->pObj2Clause[iObj];
+        iEnd = iBeg + pCnf->pObj2Count[iObj];
+        for ( c = iBeg; c < iEnd; c++ )
+            for ( pLit = pCnf->pClauses[c] + 1; pLit < pCnf->pClauses[c+1]; pLit++ )
+                Cnf_IncLoadObj_rec( p, Abc_Lit2Var(*pLit), iCopy );
+        iVar = Cnf_IncAddVars( p, 1 );
+        pObj2Var = Cnf_IncObj2Var( p, iCopy );
+        pObj2Var[iObj] = iVar;
+        for ( c = iBeg; c < iEnd; c++ )
+        {
+            Vec_IntClear( p->vLits );
+            for ( pLit = pCnf->pClauses[c]; pLit < pCnf->pClauses[c+1]; pLit++ )
+                Vec_IntPush( p->vLits, Abc_Var2Lit(pObj2Var[Abc_Lit2Var(*pLit)], Abc_LitIsCompl(*pLit)) );
+            Cnf_IncAddClause( p );
+        }
+    }
+    else if ( Gia_ObjIsAnd(pObj) )
+    {
+        iVar0 = Cnf_IncLoadObj_rec( p, Gia_ObjFaninId0(pObj, iObj), iCopy );
+        iVar1 = Cnf_IncLoadObj_rec( p, Gia_ObjFaninId1(pObj, iObj), iCopy );
+        iVar  = Cnf_IncAddVars( p, 1 );
+        p->nClauses += sat_solver_add_and( p->pSat, iVar, iVar0, iVar1, Gia_ObjFaninC0(pObj), Gia_ObjFaninC1(pObj), 0 );
+    }
+    else if ( Gia_ObjIsCo(pObj) )
+    {
+        iVar0 = Cnf_IncLoadObj_rec( p, Gia_ObjFaninId0(pObj, iObj), iCopy );
+        iVar  = Cnf_IncAddVars( p, 1 );
+        p->nClauses += sat_solver_add_buffer( p->pSat, iVar, iVar0, Gia_ObjFaninC0(pObj) );
+    }
+    else
+    {
+        assert( Gia_ObjIsConst0(pObj) );
+        iVar = Cnf_IncAddVars( p, 1 );
+        p->nClauses += sat_solver_add_const( p->pSat, iVar, 1 );
+    }
+    Cnf_IncObj2Var(p, iCopy)[iObj] = iVar;
+    Vec_IntPush( p->vLoaded, iCopy * p->nObjs + iObj );
+    return iVar;
+}
+int Cnf_IncLoadObj( Cnf_Inc_t * p, int iObj, int iCopy )
+{
+    assert( iObj >= 0 && iObj < p->nObjs && iCopy >= 0 );
+    if ( (iCopy + 1) * p->nObjs > Vec_IntSize(p->vObj2Var) )
+        Vec_IntFillExtra( p->vObj2Var, (iCopy + 1) * p->nObjs, -1 );
+    return Cnf_IncLoadObj_rec( p, iObj, iCopy );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Loads the cone of the AIG literal.]
+
+  Description [Returns the solver literal of the AIG literal in the copy.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cnf_IncLoadLit( Cnf_Inc_t * p, int iLit, int iCopy )
+{
+    return Abc_Var2Lit( Cnf_IncLoadObj(p, Abc_Lit2Var(iLit), iCopy), Abc_LitIsCompl(iLit) );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
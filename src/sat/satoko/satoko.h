@@ -65,6 +65,11 @@ struct satoko_opts {
     unsigned clause_max_sz_bin_resol;
     unsigned clause_min_lbd_bin_resol;
     float garbage_max_ratio;
+
+    /* Inprocessing */
+    unsigned n_conf_inprocess;   /* N.of conflicts between inprocessing rounds (0 = no inprocessing) */
+    unsigned inprocess_ratio;    /* Percentage of search propagations spent on vivification */
+    unsigned bve_max_occs;       /* Max occurrences of a variable polarity for elimination (0 = no BVE) */
     char verbose;
     char no_simplify;
 };
@@ -83,6 +88,15 @@ struct satoko_stats {
 
     long n_original_lits;
     long n_learnt_lits;
+
+    /* Inprocessing (accumulated over incremental calls) */
+    unsigned n_inprocess;
+    long n_vivified;
+    long n_vivified_lits;
+    long n_subsumed;
+    long n_eliminated;
+    long n_restored;
+    abctime t_inprocess;
 };
 
 
@@ -142,6 +156,11 @@ extern void satoko_set_runid(satoko_t *, int);
 extern int satoko_read_cex_varvalue(satoko_t *, int);
 extern abctime satoko_set_runtime_limit(satoko_t *, abctime);
 extern char satoko_var_polarity(satoko_t *, unsigned);
+/* Variables that are frozen are never eliminated by inprocessing. Eliminated
+ * variables are restored automatically when they appear in a new clause, an
+ * assumption or a cone, and their values are reconstructed in every model,
+ * so freezing is only needed to avoid repeated elimination and restoration. */
+extern void satoko_freeze_var(satoko_t *, int, int);
 
 
 ABC_NAMESPACE_HEADER_END
@@ -192,7 +192,7 @@ static inline unsigned solver_decide(solver_t *s)
             return UNDEF;
         }
         next_var = heap_remove_min(s->var_order);
-        if (solver_has_marks(s) && !var_mark(s, next_var))
+        if ((solver_has_marks(s) && !var_mark(s, next_var)) || var_is_eliminated(s, next_var))
             next_var = UNDEF;
     }
     return var2lit(next_var, satoko_var_polarity(s, next_var));
@@ -477,6 +477,342 @@ static inline void solver_reduce_cdb(solver_t *s)
         solver_garbage_collect(s);
 }
 
+//===------------------------------------------------------------------------===
+// Inprocessing
+//===------------------------------------------------------------------------===
+#define BVE_MAX_RESOLVENT 20
+#define INPROCESS_MIN_BUDGET 10000
+
+static inline void solver_clause_delete(solver_t *s, unsigned cref)
+{
+    struct clause *clause = clause_fetch(s, cref);
+
+    clause_unwatch(s, cref);
+    clause->f_mark = 1;
+    if (clause->f_learnt)
+        s->stats.n_learnt_lits -= clause->size;
+    else
+        s->stats.n_original_lits -= clause->size;
+    cdb_remove(s->all_clauses, clause);
+}
+
+static inline void solver_compact_clauses(solver_t *s, vec_uint_t *crefs)
+{
+    unsigned i, j = 0, cref;
+
+    vec_uint_foreach(crefs, cref, i)
+        if (!clause_fetch(s, cref)->f_mark)
+            vec_uint_assign(crefs, j++, cref);
+    vec_uint_shrink(crefs, j);
+}
+
+/**
+ *  A learnt clause is subsumed by any other clause whose literals are all in
+ *  it. Both watched literals of a subsuming clause are among the literals of
+ *  the subsumed one, so it suffices to scan the watch lists of the clause's
+ *  own literals; the blocker (always a literal of the watching clause) rules
+ *  out most candidates without fetching them.
+ */
+static inline void solver_subsume_learnts(solver_t *s, long budget)
+{
+    unsigned i, k, n_learnts = vec_uint_size(s->learnts);
+
+    for (i = 0; i < n_learnts && budget > 0; i++) {
+        unsigned cref = vec_uint_at(s->learnts, i);
+        struct clause *clause = clause_fetch(s, cref);
+        unsigned *lits = &(clause->data[0].lit);
+        unsigned subsumer = UNDEF;
+
+        if (clause->f_mark || clause->size <= 2)
+            continue;
+        if (var_value(s, lit2var(lits[0])) != SATOKO_VAR_UNASSING && lit_reason(s, lits[0]) == cref)
+            continue;
+        for (k = 0; k < clause->size; k++)
+            vec_char_assign(s->seen, lit2var(lits[k]), 1 + lit_polarity(lits[k]));
+        for (k = 0; k < clause->size && subsumer == UNDEF; k++) {
+            struct watcher *w;
+            watch_list_foreach(s->watches, w, lit_compl(lits[k])) {
+                struct clause *other;
+                unsigned j;
+
+                budget--;
+                if (w->cref == cref || vec_char_at(s->seen, lit2var(w->blocker)) != 1 + lit_polarity(w->blocker))
+                    continue;
+                other = clause_fetch(s, w->cref);
+                if (other->size > clause->size)
+                    continue;
+                for (j = 0; j < other->size; j++)
+                    if (vec_char_at(s->seen, lit2var(other->data[j].lit)) != 1 + lit_polarity(other->data[j].lit))
+                        break;
+                if (j == other->size) {
+                    subsumer = w->cref;
+                    break;
+                }
+            }
+        }
+        for (k = 0; k < clause->size; k++)
+            vec_char_assign(s->seen, lit2var(lits[k]), 0);
+        if (subsumer == UNDEF)
+            continue;
+        /* The subsumer inherits the quality of the clause it replaces */
+        if (clause_fetch(s, subsumer)->f_learnt) {
+            struct clause *other = clause_fetch(s, subsumer);
+            if (other->lbd > clause->lbd)
+                other->lbd = clause->lbd;
+            if (!clause->f_deletable)
+                other->f_deletable = 0;
+        }
+        solver_clause_delete(s, cref);
+        s->stats.n_subsumed++;
+    }
+}
+
+/**
+ *  Vivification asserts the negation of the literals of a learnt clause one
+ *  by one at a fresh decision level and propagates. When this leads to a
+ *  conflict, the asserted prefix is already a clause; when a later literal
+ *  becomes true, the prefix plus that literal is; literals that become false
+ *  are dropped. Everything derived this way follows from the clause database
+ *  by resolution, so the shortened clause may replace the original one.
+ */
+static inline int solver_vivify_learnts(solver_t *s, long budget, vec_uint_t *probe)
+{
+    unsigned i, k, n_learnts = vec_uint_size(s->learnts);
+    long limit = s->stats.n_propagations + budget;
+
+    assert(solver_dlevel(s) == 0);
+    for (i = 0; i < n_learnts && s->stats.n_propagations < limit; i++) {
+        unsigned cref = vec_uint_at(s->learnts, i);
+        struct clause *clause = clause_fetch(s, cref);
+        unsigned old_size = clause->size, lbd, f_deletable;
+        int satisfied = 0;
+
+        if (clause->f_mark || clause->size <= 2)
+            continue;
+        vec_uint_clear(s->temp_lits);
+        for (k = 0; k < clause->size; k++) {
+            unsigned lit = clause->data[k].lit;
+            if (lit_value(s, lit) == SATOKO_LIT_TRUE) {
+                satisfied = 1 + (lit_reason(s, lit) == cref);
+                break;
+            }
+            if (lit_value(s, lit) == SATOKO_LIT_FALSE)
+                continue;
+            vec_uint_push_back(s->temp_lits, lit);
+        }
+        if (satisfied == 2)
+            continue;
+        if (satisfied) {
+            solver_clause_delete(s, cref);
+            continue;
+        }
+        /* Propagation may reorder the clause, so the probe runs on a copy */
+        vec_uint_clear(probe);
+        for (k = 0; k < vec_uint_size(s->temp_lits); k++) {
+            unsigned lit = vec_uint_at(s->temp_lits, k);
+            if (lit_value(s, lit) == SATOKO_LIT_FALSE)
+                continue;
+            vec_uint_push_back(probe, lit);
+            if (lit_value(s, lit) == SATOKO_LIT_TRUE)
+                break;
+            vec_uint_push_back(s->trail_lim, vec_uint_size(s->trail));
+            solver_enqueue(s, lit_compl(lit), UNDEF);
+            if (solver_propagate(s) != UNDEF)
+                break;
+        }
+        solver_cancel_until(s, 0);
+        if (vec_uint_size(probe) == old_size)
+            continue;
+
+        s->stats.n_vivified++;
+        s->stats.n_vivified_lits += old_size - vec_uint_size(probe);
+        lbd = clause->lbd;
+        f_deletable = clause->f_deletable;
+        solver_clause_delete(s, cref);
+        if (vec_uint_size(probe) == 1) {
+            solver_enqueue(s, vec_uint_at(probe, 0), UNDEF);
+            if (solver_propagate(s) != UNDEF)
+                return SATOKO_ERR;
+            continue;
+        }
+        cref = solver_clause_create(s, probe, 1);
+        clause = clause_fetch(s, cref);
+        clause->lbd = lbd < clause->size - 1 ? lbd : clause->size - 1;
+        clause->f_deletable = f_deletable;
+        clause_watch(s, cref);
+    }
+    return SATOKO_OK;
+}
+
+/* Builds the resolvent of two clauses on 'var' without level 0 false
+ * literals. Returns 0 if it is a tautology or satisfied at level 0. */
+static inline int bve_resolve(solver_t *s, struct clause *c1, struct clause *c2, unsigned var, vec_uint_t *resolvent)
+{
+    unsigned i, lit;
+    int result = 1;
+
+    vec_uint_clear(resolvent);
+    for (i = 0; i < c1->size && result; i++) {
+        lit = c1->data[i].lit;
+        if (lit2var(lit) == var || lit_value(s, lit) == SATOKO_LIT_FALSE)
+            continue;
+        if (lit_value(s, lit) == SATOKO_LIT_TRUE)
+            result = 0;
+        else {
+            vec_char_assign(s->seen, lit2var(lit), 1 + lit_polarity(lit));
+            vec_uint_push_back(resolvent, lit);
+        }
+    }
+    for (i = 0; i < c2->size && result; i++) {
+        char seen;
+        lit = c2->data[i].lit;
+        if (lit2var(lit) == var || lit_value(s, lit) == SATOKO_LIT_FALSE)
+            continue;
+        seen = vec_char_at(s->seen, lit2var(lit));
+        if (lit_value(s, lit) == SATOKO_LIT_TRUE || (seen && seen != 1 + lit_polarity(lit)))
+            result = 0;
+        else if (!seen)
+            vec_uint_push_back(resolvent, lit);
+    }
+    vec_uint_foreach(resolvent, lit, i)
+        vec_char_assign(s->seen, lit2var(lit), 0);
+    return result;
+}
+
+static inline unsigned bve_occs_clean(solver_t *s, vec_uint_t *occs)
+{
+    unsigned i, j = 0, cref;
+
+    if (occs == NULL)
+        return 0;
+    vec_uint_foreach(occs, cref, i)
+        if (!clause_fetch(s, cref)->f_mark)
+            vec_uint_assign(occs, j++, cref);
+    vec_uint_shrink(occs, j);
+    return j;
+}
+
+static inline void bve_occs_add(solver_t *s, vec_uint_t **occs, unsigned cref)
+{
+    struct clause *clause = clause_fetch(s, cref);
+    unsigned i;
+
+    for (i = 0; i < clause->size; i++) {
+        unsigned lit = clause->data[i].lit;
+        if (occs[lit] == NULL)
+            occs[lit] = vec_uint_alloc(0);
+        vec_uint_push_back(occs[lit], cref);
+    }
+}
+
+/**
+ *  Bounded variable elimination replaces the original clauses of a variable
+ *  by their non-tautological resolvents whenever this does not increase the
+ *  number of clauses. The removed clauses go to the elimination stack, which
+ *  is used to extend models and to restore the variable if the user refers to
+ *  it again. Frozen variables, assumptions and variables assigned at level 0
+ *  are never eliminated.
+ */
+static inline int solver_bve(solver_t *s, long budget)
+{
+    unsigned n_vars = vec_char_size(s->assigns);
+    vec_uint_t **occs = satoko_calloc(vec_uint_t *, 2 * n_vars);
+    vec_uint_t *resolvent = vec_uint_alloc(0);
+    unsigned i, j, k, var, cref, lit;
+    int status = SATOKO_OK;
+
+    vec_uint_foreach(s->originals, cref, i)
+        if (!clause_fetch(s, cref)->f_mark)
+            bve_occs_add(s, occs, cref);
+    s->cur_stamp++;
+    vec_uint_foreach(s->assumptions, lit, i)
+        vec_uint_assign(s->stamps, lit2var(lit), s->cur_stamp);
+
+    for (var = 0; var < n_vars && budget > 0 && status == SATOKO_OK; var++) {
+        vec_uint_t *pos, *neg;
+        unsigned n_pos, n_neg, n_resolvents = 0;
+
+        if (vec_char_at(s->frozen, var) || var_is_eliminated(s, var) ||
+            var_value(s, var) != SATOKO_VAR_UNASSING ||
+            vec_uint_at(s->stamps, var) == s->cur_stamp)
+            continue;
+        pos = occs[var2lit(var, 0)];
+        neg = occs[var2lit(var, 1)];
+        n_pos = bve_occs_clean(s, pos);
+        n_neg = bve_occs_clean(s, neg);
+        if (n_pos + n_neg == 0 || n_pos > s->opts.bve_max_occs || n_neg > s->opts.bve_max_occs)
+            continue;
+        for (i = 0; i < n_pos && n_resolvents <= n_pos + n_neg; i++)
+            for (j = 0; j < n_neg && n_resolvents <= n_pos + n_neg; j++) {
+                budget -= clause_fetch(s, vec_uint_at(pos, i))->size + clause_fetch(s, vec_uint_at(neg, j))->size;
+                if (!bve_resolve(s, clause_fetch(s, vec_uint_at(pos, i)), clause_fetch(s, vec_uint_at(neg, j)), var, resolvent))
+                    continue;
+                if (vec_uint_size(resolvent) > BVE_MAX_RESOLVENT)
+                    n_resolvents = n_pos + n_neg;
+                n_resolvents++;
+            }
+        if (n_resolvents > n_pos + n_neg)
+            continue;
+
+        /* Add the resolvents, then move the clauses of 'var' to the stack */
+        for (i = 0; i < n_pos && status == SATOKO_OK; i++)
+            for (j = 0; j < n_neg && status == SATOKO_OK; j++) {
+                if (!bve_resolve(s, clause_fetch(s, vec_uint_at(pos, i)), clause_fetch(s, vec_uint_at(neg, j)), var, resolvent))
+                    continue;
+                if (vec_uint_size(resolvent) == 0)
+                    status = SATOKO_ERR;
+                else if (vec_uint_size(resolvent) == 1) {
+                    solver_enqueue(s, vec_uint_at(resolvent, 0), UNDEF);
+                    if (solver_propagate(s) != UNDEF)
+                        status = SATOKO_ERR;
+                } else {
+                    cref = solver_clause_create(s, resolvent, 0);
+                    clause_watch(s, cref);
+                    bve_occs_add(s, occs, cref);
+                }
+            }
+        for (k = 0; k < 2; k++) {
+            vec_uint_t *occs_var = k ? neg : pos;
+            if (occs_var == NULL)
+                continue;
+            vec_uint_foreach(occs_var, cref, i) {
+                struct clause *clause = clause_fetch(s, cref);
+                unsigned first = vec_uint_size(s->elim_stack);
+                if (clause->f_mark)
+                    continue;
+                for (j = 0; j < clause->size; j++) {
+                    vec_uint_push_back(s->elim_stack, clause->data[j].lit);
+                    if (lit2var(clause->data[j].lit) == var)
+                        stk_swap(unsigned, vec_uint_data(s->elim_stack)[first], vec_uint_data(s->elim_stack)[first + j]);
+                }
+                vec_uint_push_back(s->elim_stack, clause->size);
+                solver_clause_delete(s, cref);
+            }
+        }
+        vec_char_assign(s->eliminated, var, 1);
+        s->stats.n_eliminated++;
+    }
+    for (i = 0; i < 2 * n_vars; i++)
+        if (occs[i])
+            vec_uint_free(occs[i]);
+    satoko_free(occs);
+    vec_uint_free(resolvent);
+    solver_compact_clauses(s, s->originals);
+
+    /* Learnt clauses may not refer to eliminated variables */
+    vec_uint_foreach(s->learnts, cref, i) {
+        struct clause *clause = clause_fetch(s, cref);
+        if (clause->f_mark)
+            continue;
+        for (j = 0; j < clause->size; j++)
+            if (var_is_eliminated(s, lit2var(clause->data[j].lit))) {
+                solver_clause_delete(s, cref);
+                break;
+            }
+    }
+    return status;
+}
+
 //===------------------------------------------------------------------------===
 // Solver external functions
 //===------------------------------------------------------------------------===
@@ -690,6 +1026,58 @@ char solver_search(solver_t *s)
     }
 }
 
+/**
+ *  Runs one round of inprocessing at decision level 0: bounded variable
+ *  elimination (if enabled and no cone is marked), subsumption of learnt
+ *  clauses and learnt clause vivification. Vivification gets a share of the
+ *  propagations made by the search since the previous round. Returns
+ *  SATOKO_ERR if the problem turned out to be unsatisfiable.
+ */
+int solver_inprocess(solver_t *s)
+{
+    abctime clk = Abc_Clock();
+    long budget = (s->stats.n_propagations_all - s->n_props_inprocess) / 100 * s->opts.inprocess_ratio;
+    long n_vivified = s->stats.n_vivified, n_subsumed = s->stats.n_subsumed, n_eliminated = s->stats.n_eliminated;
+    unsigned i, lit;
+    int status = SATOKO_OK;
+
+    assert(solver_dlevel(s) == 0);
+    if (solver_propagate(s) != UNDEF)
+        return SATOKO_ERR;
+    if (budget < INPROCESS_MIN_BUDGET)
+        budget = INPROCESS_MIN_BUDGET;
+    s->stats.n_inprocess++;
+    if (s->opts.bve_max_occs && !solver_has_marks(s))
+        status = solver_bve(s, 10 * budget);
+    if (status == SATOKO_OK) {
+        /* Probing must not disturb the saved phases of the search */
+        vec_char_t *polarity = vec_char_alloc(0);
+        vec_uint_t *probe = vec_uint_alloc(0);
+        vec_char_duplicate(polarity, s->polarity);
+        solver_subsume_learnts(s, 10 * budget);
+        status = solver_vivify_learnts(s, budget, probe);
+        vec_char_copy(s->polarity, polarity);
+        vec_uint_foreach(s->trail, lit, i)
+            vec_char_assign(s->polarity, lit2var(lit), lit_polarity(lit));
+        vec_char_free(polarity);
+        vec_uint_free(probe);
+    }
+    solver_compact_clauses(s, s->learnts);
+    s->n_props_inprocess = s->stats.n_propagations_all;
+    s->n_confl_bfr_inprocess = s->stats.n_conflicts_all + s->opts.n_conf_inprocess;
+    if (status == SATOKO_OK && cdb_wasted(s->all_clauses) > cdb_size(s->all_clauses) * s->opts.garbage_max_ratio)
+        solver_garbage_collect(s);
+    s->stats.t_inprocess += Abc_Clock() - clk;
+    if (s->opts.verbose) {
+        printf("inprocess: vivified %6ld  subsumed %6ld  eliminated %6ld  learnts %7d  time %.2f sec\n",
+               s->stats.n_vivified - n_vivified, s->stats.n_subsumed - n_subsumed,
+               s->stats.n_eliminated - n_eliminated, vec_uint_size(s->learnts),
+               1.0 * (Abc_Clock() - clk) / CLOCKS_PER_SEC);
+        fflush(stdout);
+    }
+    return status;
+}
+
 //===------------------------------------------------------------------------===
 // Debug procedures
 //===------------------------------------------------------------------------===
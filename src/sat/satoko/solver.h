@@ -99,6 +99,14 @@ struct solver_t_ {
 
     /* Temporary data used for solving cones */
     vec_char_t *marks;
+
+    /* Inprocessing */
+    vec_char_t *frozen;      /* Variables that may not be eliminated */
+    vec_char_t *eliminated;  /* Variables removed by BVE */
+    vec_uint_t *elim_stack;  /* Clauses of eliminated variables: lits (eliminated
+                                literal first) followed by the clause size */
+    long n_confl_bfr_inprocess;
+    long n_props_inprocess;  /* Propagations at the end of the last round */
     
     /* Callbacks to stop the solver */
     abctime nRuntimeLimit;
@@ -115,6 +123,7 @@ extern unsigned solver_clause_create(solver_t *, vec_uint_t *, unsigned);
 extern char solver_search(solver_t *);
 extern void solver_cancel_until(solver_t *, unsigned);
 extern unsigned solver_propagate(solver_t *);
+extern int solver_inprocess(solver_t *);
 
 /* Debuging */
 extern void solver_debug_check(solver_t *, int);
@@ -150,6 +159,10 @@ static inline unsigned var_reason(solver_t *s, unsigned var)
 {
     return vec_uint_at(s->reasons, var);
 }
+static inline int var_is_eliminated(solver_t *s, unsigned var)
+{
+    return (int)vec_char_at(s->eliminated, var);
+}
 static inline int var_mark(solver_t *s, unsigned var)
 {
     return (int)vec_char_at(s->marks, var);
@@ -45,11 +45,69 @@ static inline int clause_is_satisfied(solver_t *s, struct clause *clause)
 
 static inline void solver_clean_stats(solver_t *s)
 {
-    long n_conflicts_all = s->stats.n_conflicts_all;
-    long n_propagations_all = s->stats.n_propagations_all;
+    struct satoko_stats stats = s->stats;
     memset(&(s->stats), 0, sizeof(struct satoko_stats));
-    s->stats.n_conflicts_all = n_conflicts_all;
-    s->stats.n_propagations_all = n_propagations_all;
+    s->stats.n_conflicts_all = stats.n_conflicts_all;
+    s->stats.n_propagations_all = stats.n_propagations_all;
+    s->stats.n_inprocess = stats.n_inprocess;
+    s->stats.n_vivified = stats.n_vivified;
+    s->stats.n_vivified_lits = stats.n_vivified_lits;
+    s->stats.n_subsumed = stats.n_subsumed;
+    s->stats.n_eliminated = stats.n_eliminated;
+    s->stats.n_restored = stats.n_restored;
+    s->stats.t_inprocess = stats.t_inprocess;
+}
+
+/**
+ *  Puts the clauses of all eliminated variables back into the solver. The
+ *  resolvents added by the elimination stay, they are implied anyway. Clauses
+ *  of a variable may contain variables eliminated later, therefore everything
+ *  is restored at once.
+ */
+static inline void solver_restore_eliminated(solver_t *s)
+{
+    vec_uint_t *stack = s->elim_stack;
+    unsigned i, var;
+
+    if (vec_uint_size(stack) == 0)
+        return;
+    solver_cancel_until(s, 0);
+    s->elim_stack = vec_uint_alloc(0);
+    for (var = 0; var < vec_char_size(s->eliminated); var++) {
+        if (!var_is_eliminated(s, var))
+            continue;
+        vec_char_assign(s->eliminated, var, 0);
+        if (!heap_in_heap(s->var_order, var))
+            heap_insert(s->var_order, var);
+        s->stats.n_restored++;
+    }
+    for (i = vec_uint_size(stack); i > 0 && s->status == SATOKO_OK;) {
+        unsigned size = vec_uint_at(stack, i - 1);
+        i -= size + 1;
+        satoko_add_clause(s, (int *)vec_uint_data(stack) + i, size);
+    }
+    vec_uint_free(stack);
+}
+
+/**
+ *  Assigns the eliminated variables in the model (kept in the polarity
+ *  vector). The stack is traversed backwards, so the clauses of a variable
+ *  are checked after all variables eliminated later got their values.
+ */
+static inline void solver_extend_model(solver_t *s)
+{
+    unsigned i, k, *lits;
+
+    for (i = vec_uint_size(s->elim_stack); i > 0;) {
+        unsigned size = vec_uint_at(s->elim_stack, i - 1);
+        i -= size + 1;
+        lits = vec_uint_data(s->elim_stack) + i;
+        for (k = 1; k < size; k++)
+            if (satoko_var_polarity(s, lit2var(lits[k])) == lit_polarity(lits[k]))
+                break;
+        if (k == size)
+            vec_char_assign(s->polarity, lit2var(lits[0]), lit_polarity(lits[0]));
+    }
 }
 
 static inline void print_opts(solver_t *s)
@@ -80,6 +138,12 @@ static inline void print_stats(solver_t *s)
     printf("conflicts     : %10ld\n", s->stats.n_conflicts);
     printf("decisions     : %10ld\n", s->stats.n_decisions);
     printf("propagations  : %10ld\n", s->stats.n_propagations);
+    if (s->stats.n_inprocess == 0)
+        return;
+    printf("inprocessing  : %10d rounds, %.2f sec\n", s->stats.n_inprocess, 1.0 * s->stats.t_inprocess / CLOCKS_PER_SEC);
+    printf("  vivified    : %10ld (%ld lits)\n", s->stats.n_vivified, s->stats.n_vivified_lits);
+    printf("  subsumed    : %10ld\n", s->stats.n_subsumed);
+    printf("  eliminated  : %10ld (%ld restored)\n", s->stats.n_eliminated, s->stats.n_restored);
 }
 
 //===------------------------------------------------------------------------===
@@ -126,6 +190,10 @@ solver_t * satoko_create()
     s->last_dlevel = vec_uint_alloc(0);
     /* Misc temporary */
     s->stamps = vec_uint_alloc(0);
+    /* Inprocessing */
+    s->frozen = vec_char_alloc(0);
+    s->eliminated = vec_char_alloc(0);
+    s->elim_stack = vec_uint_alloc(0);
     return s;
 }
 
@@ -153,6 +221,9 @@ void satoko_destroy(solver_t *s)
     vec_uint_free(s->stack);
     vec_uint_free(s->last_dlevel);
     vec_uint_free(s->stamps);
+    vec_char_free(s->frozen);
+    vec_char_free(s->eliminated);
+    vec_uint_free(s->elim_stack);
     if (s->marks)
         vec_char_free(s->marks);
     satoko_free(s);
@@ -188,6 +259,10 @@ void satoko_default_opts(satoko_opts_t *opts)
     opts->clause_min_lbd_bin_resol = 6;
 
     opts->garbage_max_ratio = (float) 0.3;
+    /* Inprocessing */
+    opts->n_conf_inprocess = 0;
+    opts->inprocess_ratio = 10;
+    opts->bve_max_occs = 0;
 }
 
 /**
@@ -246,6 +321,8 @@ int satoko_add_variable(solver_t *s, char sign)
     vec_uint_push_back(s->reasons, UNDEF);
     vec_uint_push_back(s->stamps, 0);
     vec_char_push_back(s->seen, 0);
+    vec_char_push_back(s->frozen, 0);
+    vec_char_push_back(s->eliminated, 0);
     heap_insert(s->var_order, var);
     if (s->marks)
         vec_char_push_back(s->marks, 0);
@@ -263,6 +340,9 @@ int satoko_add_clause(solver_t *s, int *lits, int size)
     max_var = lit2var(lits[size - 1]);
     while (max_var >= vec_act_size(s->activity))
         satoko_add_variable(s, SATOKO_LIT_FALSE);
+    for (i = 0; i < (unsigned)size && vec_uint_size(s->elim_stack); i++)
+        if (var_is_eliminated(s, lit2var(lits[i])))
+            solver_restore_eliminated(s);
 
     vec_uint_clear(s->temp_lits);
     j = 0;
@@ -298,9 +378,13 @@ int satoko_add_clause(solver_t *s, int *lits, int size)
 void satoko_assump_push(solver_t *s, int lit)
 {
     assert(lit2var(lit) < (unsigned)satoko_varnum(s));
+    if (var_is_eliminated(s, lit2var(lit)))
+        solver_restore_eliminated(s);
     // printf("[Satoko] Push assumption: %d\n", lit);
     vec_uint_push_back(s->assumptions, lit);
-    vec_char_assign(s->polarity, lit2var(lit), lit_polarity(lit));
+    /* The polarity of a variable fixed at level 0 is its model value */
+    if (var_value(s, lit2var(lit)) == SATOKO_VAR_UNASSING)
+        vec_char_assign(s->polarity, lit2var(lit), lit_polarity(lit));
 }
 
 void satoko_assump_pop(solver_t *s)
@@ -328,7 +412,18 @@ int satoko_solve(solver_t *s)
         if (satoko_simplify(s) != SATOKO_OK)
             return SATOKO_UNDEC;
 
+    /* The first round comes after n_conf_inprocess conflicts, not at once */
+    if (s->opts.n_conf_inprocess && s->n_confl_bfr_inprocess == 0)
+        s->n_confl_bfr_inprocess = s->stats.n_conflicts_all + s->opts.n_conf_inprocess;
     while (status == SATOKO_UNDEC) {
+        if (s->opts.n_conf_inprocess && !s->book_vars && s->stats.n_conflicts_all >= s->n_confl_bfr_inprocess) {
+            solver_cancel_until(s, 0);
+            if (solver_inprocess(s) != SATOKO_OK) {
+                s->status = SATOKO_ERR;
+                status = SATOKO_UNSAT;
+                break;
+            }
+        }
         status = solver_search(s);
         if (solver_check_limits(s) == 0 || solver_stop(s))
             break;
@@ -337,6 +432,8 @@ int satoko_solve(solver_t *s)
         if (s->pFuncStop && s->pFuncStop(s->RunId))
             break;
     }
+    if (status == SATOKO_SAT && vec_uint_size(s->elim_stack))
+        solver_extend_model(s);
     if (s->opts.verbose)
         print_stats(s);
     
@@ -445,6 +542,8 @@ void satoko_bookmark(satoko_t *s)
     // printf("[Satoko] Bookmark.\n");
     assert(s->status == SATOKO_OK);
     assert(solver_dlevel(s) == 0);
+    /* Restored clauses must survive the rollback */
+    solver_restore_eliminated(s);
     s->book_cl_orig = vec_uint_size(s->originals);
     s->book_cl_lrnt = vec_uint_size(s->learnts);
     s->book_vars = vec_char_size(s->assigns);
@@ -491,6 +590,9 @@ void satoko_reset(satoko_t *s)
     vec_uint_clear(s->stack);
     vec_uint_clear(s->last_dlevel);
     vec_uint_clear(s->stamps);
+    vec_char_clear(s->frozen);
+    vec_char_clear(s->eliminated);
+    vec_uint_clear(s->elim_stack);
     s->status = SATOKO_OK;
     s->var_act_inc = VAR_ACT_INIT_INC;
     s->clause_act_inc = CLAUSE_ACT_INIT_INC;
@@ -503,6 +605,8 @@ void satoko_reset(satoko_t *s)
     s->book_vars = 0;
     s->book_trail = 0;
     s->i_qhead = 0;
+    s->n_confl_bfr_inprocess = 0;
+    s->n_props_inprocess = 0;
 }
 
 void satoko_rollback(satoko_t *s)
@@ -546,6 +650,8 @@ void satoko_rollback(satoko_t *s)
     vec_char_shrink(s->assigns, s->book_vars);
     vec_char_shrink(s->seen, s->book_vars);
     vec_char_shrink(s->polarity, s->book_vars);
+    vec_char_shrink(s->frozen, s->book_vars);
+    vec_char_shrink(s->eliminated, s->book_vars);
     solver_rebuild_order(s);
     /* Rewind solver and cancel level 0 assignments to the trail */
     solver_cancel_until(s, 0);
@@ -564,6 +670,9 @@ void satoko_mark_cone(satoko_t *s, int * pvars, int n_vars)
     int i;
     if (!solver_has_marks(s))
         s->marks = vec_char_init(satoko_varnum(s), 0);
+    for (i = 0; i < n_vars && vec_uint_size(s->elim_stack); i++)
+        if (var_is_eliminated(s, pvars[i]))
+            solver_restore_eliminated(s);
     for (i = 0; i < n_vars; i++) {
         var_set_mark(s, pvars[i]);
         vec_sdbl_assign(s->activity, pvars[i], 0);
@@ -674,4 +783,12 @@ char satoko_var_polarity(satoko_t *s, unsigned var)
     return vec_char_at(s->polarity, var);
 }
 
+void satoko_freeze_var(satoko_t *s, int var, int freeze)
+{
+    assert(var < satoko_varnum(s));
+    if (freeze && var_is_eliminated(s, var))
+        solver_restore_eliminated(s);
+    vec_char_assign(s->frozen, var, (char)(freeze != 0));
+}
+
 ABC_NAMESPACE_IMPL_END